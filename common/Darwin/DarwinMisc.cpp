@@ -16,10 +16,13 @@
 #include <cstring>
 #include <cstdlib>
 #include <optional>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/sysctl.h>
 #include <time.h>
+#include <unistd.h>
 #include <mach/mach_init.h>
 #include <mach/mach_port.h>
 #include <mach/mach_time.h>
@@ -318,6 +321,34 @@ void HostSys::UnmapSharedMemory(void* baseaddr, size_t size)
 		pxFailRel("Failed to unmap shared memory");
 }
 
+void* HostSys::MapFileReadOnly(const char* path, size_t* size)
+{
+	const int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return nullptr;
+
+	void* ptr = nullptr;
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED)
+			ptr = nullptr;
+		else
+			*size = static_cast<size_t>(st.st_size);
+	}
+
+	// the mapping holds its own reference to the file
+	close(fd);
+	return ptr;
+}
+
+void HostSys::UnmapFile(void* baseaddr, size_t size)
+{
+	if (munmap(baseaddr, size) != 0)
+		pxFailRel("Failed to unmap file");
+}
+
 #ifdef _M_ARM64
 
 void HostSys::FlushInstructionCache(void* address, u32 size)
@@ -105,6 +105,11 @@ namespace HostSys
 	extern void* MapSharedMemory(void* handle, size_t offset, void* baseaddr, size_t size, const PageProtectionMode& mode);
 	extern void UnmapSharedMemory(void* baseaddr, size_t size);
 
+	/// Maps an existing file read-only. Pages are backed by the OS file cache, so processes mapping the
+	/// same file share the physical memory. Returns nullptr on failure, otherwise stores the file size in size.
+	extern void* MapFileReadOnly(const char* path, size_t* size);
+	extern void UnmapFile(void* baseaddr, size_t size);
+
 	/// JIT write protect for Apple Silicon. Needs to be called prior to writing to any RWX pages.
 #if !defined(__APPLE__) || !defined(_M_ARM64)
 	// clang-format -off
@@ -14,6 +14,7 @@
 #include <fcntl.h>
 #include <mutex>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <ucontext.h>
 #include <unistd.h>
 
@@ -138,6 +139,34 @@ void HostSys::UnmapSharedMemory(void* baseaddr, size_t size)
 		pxFailRel("Failed to unmap shared memory");
 }
 
+void* HostSys::MapFileReadOnly(const char* path, size_t* size)
+{
+	const int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return nullptr;
+
+	void* ptr = nullptr;
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED)
+			ptr = nullptr;
+		else
+			*size = static_cast<size_t>(st.st_size);
+	}
+
+	// the mapping holds its own reference to the file
+	close(fd);
+	return ptr;
+}
+
+void HostSys::UnmapFile(void* baseaddr, size_t size)
+{
+	if (munmap(baseaddr, size) != 0)
+		pxFailRel("Failed to unmap file");
+}
+
 size_t HostSys::GetRuntimePageSize()
 {
 	int res = sysconf(_SC_PAGESIZE);
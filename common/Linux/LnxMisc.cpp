@@ -14,6 +14,7 @@
 #include "fmt/core.h"
 
 #include <ctype.h>
+#include <errno.h>
 #include <time.h>
 #include <unistd.h>
 #include <optional>
@@ -203,7 +204,12 @@ bool Common::PlaySoundAsync(const char* path)
 
 void Threading::Sleep(int ms)
 {
-	usleep(1000 * ms);
+	// Signals (e.g. SIGPROF from the profiler) cut the sleep short, so carry on with whatever is left.
+	struct timespec ts;
+	ts.tv_sec = static_cast<time_t>(ms / 1000);
+	ts.tv_nsec = static_cast<long>(ms % 1000) * 1000000L;
+	while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+		;
 }
 
 void Threading::SleepUntil(u64 ticks)
@@ -211,5 +217,6 @@ void Threading::SleepUntil(u64 ticks)
 	struct timespec ts;
 	ts.tv_sec = static_cast<time_t>(ticks / 1000000000ULL);
 	ts.tv_nsec = static_cast<long>(ticks % 1000000000ULL);
-	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+		;
 }
@@ -4,14 +4,35 @@
 #include "common/Perf.h"
 #include "common/Pcsx2Defs.h"
 #include "common/Assertions.h"
+#include "common/FileSystem.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 
 #ifdef ENABLE_VTUNE
 #include "jitprofiling.h"
 #endif
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
 #include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include "common/RedtapeWindows.h"
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#elif defined(__linux__)
+#include <csignal>
+#include <pthread.h>
+#include <ucontext.h>
+#endif
 
 #ifdef __linux__
 #include <atomic>
@@ -178,38 +199,444 @@ namespace Perf
 #endif
 
 #if (defined(__linux__) && (defined(ProfileWithPerf) || defined(ProfileWithPerfJitDump))) || defined(ENABLE_VTUNE)
+	static constexpr bool s_has_method_backend = true;
+#else
+	static constexpr bool s_has_method_backend = false;
+	static void RegisterMethod(const void* ptr, size_t size, const char* symbol) {}
+#endif
+
+	namespace Sampler
+	{
+		static constexpr u32 STACK_SLOTS = 16;
+		static constexpr u32 RING_SIZE = 1024;
+
+		struct RawSample
+		{
+			uptr ip;
+			uptr stack[STACK_SLOTS];
+		};
+
+		struct CodeRange
+		{
+			uptr end;
+			const char* group;
+			std::string symbol;
+		};
+
+		struct Counts
+		{
+			const char* group;
+			u64 samples;
+			u64 native_samples;
+		};
+
+		static bool InitializeTarget();
+		static void ShutdownTarget();
+		static void CaptureSample();
+		static void PushSample(uptr ip, uptr sp, uptr lr);
+		static void DrainSamples();
+		static const CodeRange* LookupCode(uptr addr);
+		static void AddCodeRange(const void* ptr, size_t size, const char* group, const char* symbol);
+		static void ThreadEntryPoint(u32 interval_us);
+
+		static std::atomic_bool s_active{false};
+		static std::atomic_bool s_stop{false};
+		static std::thread s_thread;
+
+		// Filled by the target thread's signal handler on Linux, so it can't take locks.
+		static RawSample s_ring[RING_SIZE];
+		static std::atomic<u32> s_ring_read{0};
+		static std::atomic<u32> s_ring_write{0};
+		static std::atomic<u64> s_dropped_samples{0};
+
+		// Registration can happen on any thread (e.g. MTVU), sample processing happens on the sampler thread.
+		static std::mutex s_mutex;
+		static std::map<uptr, CodeRange> s_code_map;
+		static std::unordered_map<std::string, Counts> s_counts;
+		static u64 s_total_samples = 0;
+		static u64 s_unknown_samples = 0;
+	} // namespace Sampler
+
+#if defined(_WIN32)
+	static HANDLE s_sampler_target = nullptr;
+
+	bool Sampler::InitializeTarget()
+	{
+		s_sampler_target = OpenThread(
+			THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION, FALSE, GetCurrentThreadId());
+		return (s_sampler_target != nullptr);
+	}
+
+	void Sampler::ShutdownTarget()
+	{
+		CloseHandle(s_sampler_target);
+		s_sampler_target = nullptr;
+	}
+
+	void Sampler::CaptureSample()
+	{
+		// Nothing between suspend and resume may allocate or lock, the target could be holding the heap lock.
+		if (SuspendThread(s_sampler_target) == static_cast<DWORD>(-1))
+			return;
+
+		alignas(16) CONTEXT ctx = {};
+		ctx.ContextFlags = CONTEXT_CONTROL;
+		if (GetThreadContext(s_sampler_target, &ctx))
+		{
+#if defined(_M_X86)
+			PushSample(ctx.Rip, ctx.Rsp, 0);
+#elif defined(_M_ARM64)
+			PushSample(ctx.Pc, ctx.Sp, ctx.Lr);
+#endif
+		}
+
+		ResumeThread(s_sampler_target);
+	}
+#elif defined(__APPLE__)
+	static mach_port_t s_sampler_target = MACH_PORT_NULL;
+
+	bool Sampler::InitializeTarget()
+	{
+		s_sampler_target = pthread_mach_thread_np(pthread_self());
+		return (s_sampler_target != MACH_PORT_NULL);
+	}
+
+	void Sampler::ShutdownTarget()
+	{
+		s_sampler_target = MACH_PORT_NULL;
+	}
+
+	void Sampler::CaptureSample()
+	{
+		// Nothing between suspend and resume may allocate or lock, the target could be holding the heap lock.
+		if (thread_suspend(s_sampler_target) != KERN_SUCCESS)
+			return;
+
+#if defined(_M_X86)
+		x86_thread_state64_t state;
+		mach_msg_type_number_t count = x86_THREAD_STATE64_COUNT;
+		if (thread_get_state(s_sampler_target, x86_THREAD_STATE64, reinterpret_cast<thread_state_t>(&state), &count) ==
+			KERN_SUCCESS)
+		{
+			PushSample(state.__rip, state.__rsp, 0);
+		}
+#elif defined(_M_ARM64)
+		arm_thread_state64_t state;
+		mach_msg_type_number_t count = ARM_THREAD_STATE64_COUNT;
+		if (thread_get_state(s_sampler_target, ARM_THREAD_STATE64, reinterpret_cast<thread_state_t>(&state), &count) ==
+			KERN_SUCCESS)
+		{
+			PushSample(arm_thread_state64_get_pc(state), arm_thread_state64_get_sp(state),
+				arm_thread_state64_get_lr(state));
+		}
+#endif
+
+		thread_resume(s_sampler_target);
+	}
+#elif defined(__linux__)
+	static pthread_t s_sampler_target;
+	static bool s_sampler_handler_installed = false;
+
+	static void SamplerSignalHandler(int sig, siginfo_t* info, void* ctx)
+	{
+		if (!Sampler::s_active.load(std::memory_order_relaxed))
+			return;
+
+		const ucontext_t* uc = static_cast<const ucontext_t*>(ctx);
+#if defined(_M_X86)
+		Sampler::PushSample(static_cast<uptr>(uc->uc_mcontext.gregs[REG_RIP]),
+			static_cast<uptr>(uc->uc_mcontext.gregs[REG_RSP]), 0);
+#elif defined(_M_ARM64)
+		Sampler::PushSample(static_cast<uptr>(uc->uc_mcontext.pc), static_cast<uptr>(uc->uc_mcontext.sp),
+			static_cast<uptr>(uc->uc_mcontext.regs[30]));
+#endif
+	}
+
+	bool Sampler::InitializeTarget()
+	{
+		// The handler stays installed after stopping, a signal could still be in flight.
+		if (!s_sampler_handler_installed)
+		{
+			struct sigaction sa = {};
+			sa.sa_sigaction = SamplerSignalHandler;
+			sa.sa_flags = SA_SIGINFO | SA_RESTART;
+			sigemptyset(&sa.sa_mask);
+			if (sigaction(SIGPROF, &sa, nullptr) != 0)
+				return false;
+
+			s_sampler_handler_installed = true;
+		}
+
+		s_sampler_target = pthread_self();
+		return true;
+	}
+
+	void Sampler::ShutdownTarget()
+	{
+	}
+
+	void Sampler::CaptureSample()
+	{
+		pthread_kill(s_sampler_target, SIGPROF);
+	}
+#else
+	bool Sampler::InitializeTarget()
+	{
+		return false;
+	}
+
+	void Sampler::ShutdownTarget()
+	{
+	}
+
+	void Sampler::CaptureSample()
+	{
+	}
+#endif
+
+	void Sampler::PushSample(uptr ip, uptr sp, uptr lr)
+	{
+		const u32 write = s_ring_write.load(std::memory_order_relaxed);
+		if ((write - s_ring_read.load(std::memory_order_acquire)) >= RING_SIZE)
+		{
+			s_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		// Keep the top of the stack around, so samples in native code can be charged to whoever called it.
+		RawSample& sample = s_ring[write % RING_SIZE];
+		sample.ip = ip;
+		u32 slot = 0;
+		if (lr != 0)
+			sample.stack[slot++] = lr;
+		std::memcpy(&sample.stack[slot], reinterpret_cast<const void*>(sp), (STACK_SLOTS - slot) * sizeof(uptr));
+
+		s_ring_write.store(write + 1, std::memory_order_release);
+	}
+
+	const Sampler::CodeRange* Sampler::LookupCode(uptr addr)
+	{
+		auto it = s_code_map.upper_bound(addr);
+		if (it == s_code_map.begin())
+			return nullptr;
+
+		--it;
+		return (addr < it->second.end) ? &it->second : nullptr;
+	}
+
+	void Sampler::DrainSamples()
+	{
+		u32 read = s_ring_read.load(std::memory_order_relaxed);
+		const u32 write = s_ring_write.load(std::memory_order_acquire);
+		if (read == write)
+			return;
+
+		std::unique_lock lock(s_mutex);
+		for (; read != write; read++)
+		{
+			const RawSample& sample = s_ring[read % RING_SIZE];
+			s_total_samples++;
+
+			if (const CodeRange* code = LookupCode(sample.ip))
+			{
+				s_counts.try_emplace(code->symbol, Counts{code->group, 0, 0}).first->second.samples++;
+				continue;
+			}
+
+			// Not in recompiled code. The first stack slot which looks like a return address into it is taken as
+			// the caller, which is a heuristic, but the handlers called from blocks and dispatchers keep shallow
+			// frames. Return addresses point past the call, which can be the end of the range.
+			const CodeRange* caller = nullptr;
+			for (const uptr value : sample.stack)
+			{
+				if ((caller = LookupCode(value - 1)) != nullptr)
+					break;
+			}
+
+			if (caller)
+				s_counts.try_emplace(caller->symbol, Counts{caller->group, 0, 0}).first->second.native_samples++;
+			else
+				s_unknown_samples++;
+		}
+
+		s_ring_read.store(read, std::memory_order_release);
+	}
+
+	void Sampler::AddCodeRange(const void* ptr, size_t size, const char* group, const char* symbol)
+	{
+		const uptr start = reinterpret_cast<uptr>(ptr);
+		const uptr end = start + size;
+
+		std::unique_lock lock(s_mutex);
+
+		// Code caches get reused after a flush, so anything the new code overlaps is stale.
+		auto it = s_code_map.upper_bound(start);
+		if (it != s_code_map.begin() && std::prev(it)->second.end > start)
+			--it;
+		while (it != s_code_map.end() && it->first < end)
+			it = s_code_map.erase(it);
+
+		s_code_map.emplace(start, CodeRange{end, group, symbol});
+	}
+
+	void Sampler::ThreadEntryPoint(u32 interval_us)
+	{
+		Threading::SetNameOfCurrentThread("JIT Sampler");
+
+		const std::chrono::microseconds interval(interval_us);
+		while (!s_stop.load(std::memory_order_acquire))
+		{
+			std::this_thread::sleep_for(interval);
+			CaptureSample();
+			DrainSamples();
+		}
+	}
+
+	bool Sampler::Start(u32 interval_us)
+	{
+		if (s_active.load(std::memory_order_relaxed))
+			return true;
+
+		if (!InitializeTarget())
+			return false;
+
+		{
+			std::unique_lock lock(s_mutex);
+			s_code_map.clear();
+			s_counts.clear();
+			s_total_samples = 0;
+			s_unknown_samples = 0;
+		}
+
+		s_ring_read.store(0, std::memory_order_relaxed);
+		s_ring_write.store(0, std::memory_order_relaxed);
+		s_dropped_samples.store(0, std::memory_order_relaxed);
+		s_stop.store(false, std::memory_order_relaxed);
+		s_active.store(true, std::memory_order_release);
+		s_thread = std::thread(&ThreadEntryPoint, interval_us);
+		return true;
+	}
+
+	void Sampler::Stop()
+	{
+		if (!s_active.load(std::memory_order_relaxed))
+			return;
+
+		s_stop.store(true, std::memory_order_release);
+		s_thread.join();
+		s_active.store(false, std::memory_order_release);
+		ShutdownTarget();
+		DrainSamples();
+
+		// Counts are kept for reporting, but the code map is only useful while the caches are being tracked.
+		std::unique_lock lock(s_mutex);
+		s_code_map.clear();
+	}
+
+	bool Sampler::IsActive()
+	{
+		return s_active.load(std::memory_order_relaxed);
+	}
+
+	Sampler::Report Sampler::GetReport(size_t max_entries)
+	{
+		Report report = {};
+		report.dropped_samples = s_dropped_samples.load(std::memory_order_relaxed);
+
+		std::unique_lock lock(s_mutex);
+		report.total_samples = s_total_samples;
+		report.unknown_samples = s_unknown_samples;
+
+		using CountsPair = std::pair<const std::string, Counts>;
+		std::vector<const CountsPair*> sorted;
+		sorted.reserve(s_counts.size());
+		for (const CountsPair& it : s_counts)
+			sorted.push_back(&it);
+
+		const size_t count = (max_entries == 0) ? sorted.size() : std::min(max_entries, sorted.size());
+		std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+			[](const CountsPair* lhs, const CountsPair* rhs) {
+				return (lhs->second.samples + lhs->second.native_samples) >
+					   (rhs->second.samples + rhs->second.native_samples);
+			});
+
+		report.entries.reserve(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			report.entries.push_back(
+				Entry{sorted[i]->first, sorted[i]->second.group, sorted[i]->second.samples, sorted[i]->second.native_samples});
+		}
+
+		return report;
+	}
+
+	bool Sampler::ExportReport(const char* path)
+	{
+		const Report report = GetReport(0);
+		auto fp = FileSystem::OpenManagedCFile(path, "wb");
+		if (!fp)
+			return false;
+
+		for (const Entry& entry : report.entries)
+		{
+			const char* group = (entry.group && entry.group[0]) ? entry.group : "JIT";
+			if (entry.samples > 0)
+				std::fprintf(fp.get(), "%s;%s %" PRIu64 "\n", group, entry.symbol.c_str(), entry.samples);
+			if (entry.native_samples > 0)
+				std::fprintf(fp.get(), "%s;%s;[native] %" PRIu64 "\n", group, entry.symbol.c_str(), entry.native_samples);
+		}
+
+		if (report.unknown_samples > 0)
+			std::fprintf(fp.get(), "[unknown] %" PRIu64 "\n", report.unknown_samples);
+
+		return (std::ferror(fp.get()) == 0);
+	}
+
 	void Group::Register(const void* ptr, size_t size, const char* symbol)
 	{
+		const bool sampling = Sampler::IsActive();
+		if (!s_has_method_backend && !sampling)
+			return;
+
 		char full_symbol[128];
 		if (HasPrefix())
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%s", m_prefix, symbol);
 		else
 			StringUtil::Strlcpy(full_symbol, symbol, std::size(full_symbol));
 		RegisterMethod(ptr, size, full_symbol);
+		if (sampling)
+			Sampler::AddCodeRange(ptr, size, m_prefix, full_symbol);
 	}
 
 	void Group::RegisterPC(const void* ptr, size_t size, u32 pc)
 	{
+		const bool sampling = Sampler::IsActive();
+		if (!s_has_method_backend && !sampling)
+			return;
+
 		char full_symbol[128];
 		if (HasPrefix())
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%08X", m_prefix, pc);
 		else
 			std::snprintf(full_symbol, std::size(full_symbol), "%08X", pc);
 		RegisterMethod(ptr, size, full_symbol);
+		if (sampling)
+			Sampler::AddCodeRange(ptr, size, m_prefix, full_symbol);
 	}
 
 	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key)
 	{
+		const bool sampling = Sampler::IsActive();
+		if (!s_has_method_backend && !sampling)
+			return;
+
 		char full_symbol[128];
 		if (HasPrefix())
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%s%016" PRIX64, m_prefix, prefix, key);
 		else
 			std::snprintf(full_symbol, std::size(full_symbol), "%s%016" PRIX64, prefix, key);
 		RegisterMethod(ptr, size, full_symbol);
+		if (sampling)
+			Sampler::AddCodeRange(ptr, size, m_prefix, full_symbol);
 	}
-#else
-	void Group::Register(const void* ptr, size_t size, const char* symbol) {}
-	void Group::RegisterPC(const void* ptr, size_t size, u32 pc) {}
-	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key) {}
-#endif
 } // namespace Perf
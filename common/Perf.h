@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cstdio>
+#include <string>
 #include "common/Pcsx2Types.h"
 
 namespace Perf
@@ -28,4 +29,39 @@ namespace Perf
 	extern Group vu0;
 	extern Group vu1;
 	extern Group vif;
+
+	/// Built-in sampling profiler for recompiled code. Periodically captures the instruction pointer of the thread
+	/// which started it, and attributes each sample to the code registered through the groups above. Samples which
+	/// land in native code are charged to the innermost recompiled caller found on the stack, which is how time in
+	/// memory handlers and event tests shows up against the dispatchers which called them.
+	namespace Sampler
+	{
+		struct Entry
+		{
+			std::string symbol;
+			const char* group; // Group prefix, empty for ungrouped code such as dispatchers.
+			u64 samples; // Samples with the instruction pointer inside this code.
+			u64 native_samples; // Samples in native code called from this code.
+		};
+
+		struct Report
+		{
+			u64 total_samples;
+			u64 unknown_samples;
+			u64 dropped_samples;
+			std::vector<Entry> entries; // Sorted by total samples, hottest first.
+		};
+
+		/// Starts sampling the calling thread every interval_us microseconds. Only code registered after this
+		/// call can be attributed, so callers should flush their code caches afterwards.
+		bool Start(u32 interval_us);
+		void Stop();
+		bool IsActive();
+
+		/// Returns the hottest max_entries entries, or all of them when max_entries is zero.
+		Report GetReport(size_t max_entries);
+
+		/// Writes the profile in the folded stack format understood by flamegraph.pl and speedscope.
+		bool ExportReport(const char* path);
+	} // namespace Sampler
 } // namespace Perf
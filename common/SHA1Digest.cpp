@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "SHA1Digest.h"
+#include <cstring>
+
+// Straightforward FIPS 180-1 implementation, in the same spirit as MD5Digest.
+
+static inline u32 Rol32(u32 value, u32 bits)
+{
+	return (value << bits) | (value >> (32 - bits));
+}
+
+static void SHA1Transform(u32 state[5], const u8 block[64])
+{
+	u32 w[80];
+	for (u32 i = 0; i < 16; i++)
+	{
+		w[i] = (static_cast<u32>(block[i * 4]) << 24) | (static_cast<u32>(block[i * 4 + 1]) << 16) |
+			   (static_cast<u32>(block[i * 4 + 2]) << 8) | static_cast<u32>(block[i * 4 + 3]);
+	}
+	for (u32 i = 16; i < 80; i++)
+		w[i] = Rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+	u32 a = state[0];
+	u32 b = state[1];
+	u32 c = state[2];
+	u32 d = state[3];
+	u32 e = state[4];
+
+	for (u32 i = 0; i < 80; i++)
+	{
+		u32 f, k;
+		if (i < 20)
+		{
+			f = d ^ (b & (c ^ d));
+			k = 0x5a827999;
+		}
+		else if (i < 40)
+		{
+			f = b ^ c ^ d;
+			k = 0x6ed9eba1;
+		}
+		else if (i < 60)
+		{
+			f = (b & c) | (d & (b | c));
+			k = 0x8f1bbcdc;
+		}
+		else
+		{
+			f = b ^ c ^ d;
+			k = 0xca62c1d6;
+		}
+
+		const u32 temp = Rol32(a, 5) + f + e + k + w[i];
+		e = d;
+		d = c;
+		c = Rol32(b, 30);
+		b = a;
+		a = temp;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+}
+
+SHA1Digest::SHA1Digest()
+{
+	Reset();
+}
+
+void SHA1Digest::Reset()
+{
+	state[0] = 0x67452301;
+	state[1] = 0xefcdab89;
+	state[2] = 0x98badcfe;
+	state[3] = 0x10325476;
+	state[4] = 0xc3d2e1f0;
+	count = 0;
+	std::memset(buffer, 0, sizeof(buffer));
+}
+
+void SHA1Digest::Update(const void* pData, u32 cbData)
+{
+	const u8* pByteData = static_cast<const u8*>(pData);
+	u32 used = static_cast<u32>(count & 63);
+	count += cbData;
+
+	// Finish off any partial block first.
+	if (used > 0)
+	{
+		const u32 fill = 64 - used;
+		if (cbData < fill)
+		{
+			std::memcpy(buffer + used, pByteData, cbData);
+			return;
+		}
+
+		std::memcpy(buffer + used, pByteData, fill);
+		SHA1Transform(state, buffer);
+		pByteData += fill;
+		cbData -= fill;
+	}
+
+	for (; cbData >= 64; cbData -= 64, pByteData += 64)
+		SHA1Transform(state, pByteData);
+
+	if (cbData > 0)
+		std::memcpy(buffer, pByteData, cbData);
+}
+
+void SHA1Digest::Final(u8 Digest[DIGEST_SIZE])
+{
+	const u64 bit_count = count << 3;
+	u32 used = static_cast<u32>(count & 63);
+
+	buffer[used++] = 0x80;
+	if (used > 56)
+	{
+		std::memset(buffer + used, 0, 64 - used);
+		SHA1Transform(state, buffer);
+		used = 0;
+	}
+	std::memset(buffer + used, 0, 56 - used);
+
+	for (u32 i = 0; i < 8; i++)
+		buffer[56 + i] = static_cast<u8>(bit_count >> (56 - i * 8));
+	SHA1Transform(state, buffer);
+
+	for (u32 i = 0; i < 5; i++)
+	{
+		Digest[i * 4] = static_cast<u8>(state[i] >> 24);
+		Digest[i * 4 + 1] = static_cast<u8>(state[i] >> 16);
+		Digest[i * 4 + 2] = static_cast<u8>(state[i] >> 8);
+		Digest[i * 4 + 3] = static_cast<u8>(state[i]);
+	}
+
+	Reset();
+}
@@ -9,6 +9,7 @@
 #include "common/RedtapeWindows.h"
 #endif
 
+#include <cerrno>
 #include <limits>
 
 // --------------------------------------------------------------------------------------
@@ -171,7 +172,9 @@ void Threading::KernelSemaphore::Wait()
 #ifdef _WIN32
 	WaitForSingleObject(m_sema, INFINITE);
 #else
-	sem_wait(&m_sema);
+	// Signals (e.g. the JIT profiler's SIGPROF) interrupt sem_wait() regardless of SA_RESTART.
+	while (sem_wait(&m_sema) != 0 && errno == EINTR)
+		;
 #endif
 }
 
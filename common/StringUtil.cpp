@@ -482,6 +482,42 @@ namespace StringUtil
 		}
 	}
 
+	std::string JSONString(const std::string_view str)
+	{
+		std::string ret;
+		ret.reserve(str.size() + 2);
+		ret.push_back('"');
+		for (const char ch : str)
+		{
+			switch (ch)
+			{
+				case '"':
+					ret.append("\\\"");
+					break;
+				case '\\':
+					ret.append("\\\\");
+					break;
+				case '\n':
+					ret.append("\\n");
+					break;
+				case '\r':
+					ret.append("\\r");
+					break;
+				case '\t':
+					ret.append("\\t");
+					break;
+				default:
+					if (static_cast<u8>(ch) < 0x20)
+						ret.append(fmt::format("\\u{:04x}", static_cast<u8>(ch)));
+					else
+						ret.push_back(ch);
+					break;
+			}
+		}
+		ret.push_back('"');
+		return ret;
+	}
+
 #ifdef _WIN32
 	std::wstring UTF8StringToWideString(const std::string_view str)
 	{
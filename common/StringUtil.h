@@ -273,6 +273,9 @@ namespace StringUtil
 	std::string Ellipsise(const std::string_view str, u32 max_length, const char* ellipsis = "...");
 	void EllipsiseInPlace(std::string& str, u32 max_length, const char* ellipsis = "...");
 
+	/// Returns the string as a quoted JSON string literal, escaping quotes, backslashes and control characters.
+	std::string JSONString(const std::string_view str);
+
 	/// Strided memcpy/memcmp.
 	static inline void StrideMemCpy(void* dst, std::size_t dst_stride, const void* src, std::size_t src_stride,
 		std::size_t copy_size, std::size_t count)
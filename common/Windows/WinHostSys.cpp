@@ -7,6 +7,7 @@
 #include "common/BitUtils.h"
 #include "common/Console.h"
 #include "common/Error.h"
+#include "common/FileSystem.h"
 #include "common/RedtapeWindows.h"
 #include "common/StringUtil.h"
 
@@ -100,6 +101,39 @@ void HostSys::UnmapSharedMemory(void* baseaddr, size_t size)
 		pxFail("Failed to unmap shared memory");
 }
 
+void* HostSys::MapFileReadOnly(const char* path, size_t* size)
+{
+	const HANDLE file = CreateFileW(FileSystem::GetWin32Path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	void* ptr = nullptr;
+	LARGE_INTEGER file_size;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+	{
+		const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping)
+		{
+			ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (ptr)
+				*size = static_cast<size_t>(file_size.QuadPart);
+
+			// the view holds its own reference to the mapping
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+	return ptr;
+}
+
+void HostSys::UnmapFile(void* baseaddr, size_t size)
+{
+	if (!UnmapViewOfFile(baseaddr))
+		pxFail("Failed to unmap file");
+}
+
 size_t HostSys::GetRuntimePageSize()
 {
 	SYSTEM_INFO si = {};
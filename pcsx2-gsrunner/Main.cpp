@@ -24,6 +24,7 @@
 #include "common/ProgressCallback.h"
 #include "common/SettingsWrapper.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 
 #include "pcsx2/PrecompiledHeader.h"
 
@@ -31,6 +32,7 @@
 #include "pcsx2/CDVD/CDVD.h"
 #include "pcsx2/GS.h"
 #include "pcsx2/GS/GSPerfMon.h"
+#include "pcsx2/GS/GSXXH.h"
 #include "pcsx2/GSDumpReplayer.h"
 #include "pcsx2/GameList.h"
 #include "pcsx2/Host.h"
@@ -53,6 +55,10 @@ namespace GSRunner
 	static bool ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& params);
 	static void DumpStats();
 
+	static void RunBenchmark(const std::string& filename);
+	static std::optional<u64> GetFinalFrameHash();
+	static bool WriteBenchmarkReport(const std::string& filename, double elapsed, u64 frames, std::optional<u64> frame_hash);
+
 	static bool CreatePlatformWindow();
 	static void DestroyPlatformWindow();
 	static std::optional<WindowInfo> GetPlatformWindowInfo();
@@ -89,6 +95,27 @@ static u64 s_total_readbacks = 0;
 static u32 s_total_frames = 0;
 static u32 s_total_drawn_frames = 0;
 
+// Benchmark mode. Samples are appended on the GS thread and read by the CPU thread, under the mutex.
+struct BenchmarkSample
+{
+	double time;
+	u64 frame;
+	float fps;
+	float speed;
+	double ee_usage;
+	float gs_usage;
+	float vu_usage;
+	double iop_mhz;
+};
+
+static u32 s_benchmark_frames = 0;
+static std::string s_benchmark_report_path;
+static bool s_benchmark_frame_hash = false;
+static bool s_renderer_specified = false;
+static std::mutex s_benchmark_samples_mutex;
+static Common::Timer s_benchmark_timer;
+static std::vector<BenchmarkSample> s_benchmark_samples;
+
 bool GSRunner::InitializeConfig()
 {
 	EmuFolders::SetAppRoot();
@@ -312,6 +339,20 @@ void Host::OnGameChanged(const std::string& title, const std::string& elf_overri
 
 void Host::OnPerformanceMetricsUpdated()
 {
+	if (s_benchmark_frames == 0)
+		return;
+
+	std::unique_lock lock(s_benchmark_samples_mutex);
+	s_benchmark_samples.push_back(BenchmarkSample{
+		s_benchmark_timer.GetTimeSeconds(),
+		PerformanceMetrics::GetFrameNumber(),
+		PerformanceMetrics::GetFPS(),
+		PerformanceMetrics::GetSpeed(),
+		PerformanceMetrics::GetCPUThreadUsage(),
+		PerformanceMetrics::GetGSThreadUsage(),
+		THREAD_VU1 ? PerformanceMetrics::GetVUThreadUsage() : 0.0f,
+		PerformanceMetrics::GetIOPCyclesPerSecond() / 1000000.0,
+	});
 }
 
 void Host::OnSaveStateLoading(const std::string_view filename)
@@ -444,11 +485,16 @@ static void PrintCommandLineHelp(const char* progname)
 	std::fprintf(stderr, "  -version: Displays version information and exits.\n");
 	std::fprintf(stderr, "  -dumpdir <dir>: Frame dump directory (will be dumped as filename_frameN.png).\n");
 	std::fprintf(stderr, "  -loop <count>: Loops dump playback N times. Defaults to 1. 0 will loop infinitely.\n");
+	std::fprintf(stderr, "  -startframe <frame>: Starts dump playback at the keyframe before the given frame.\n");
 	std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Defaults to Auto.\n");
 	std::fprintf(stderr, "  -window: Forces a window to be displayed.\n");
 	std::fprintf(stderr, "  -surfaceless: Disables showing a window.\n");
 	std::fprintf(stderr, "  -logfile <filename>: Writes emu log to filename.\n");
 	std::fprintf(stderr, "  -noshadercache: Disables the shader cache (useful for parallel runs).\n");
+	std::fprintf(stderr, "  -frames <count>: Boots a game instead of a dump, and runs it uncapped for N frames\n"
+						 "    with the null renderer (unless -renderer is given) and a constant RTC.\n");
+	std::fprintf(stderr, "  -report <filename>: Writes a JSON performance report at the end of a -frames run.\n");
+	std::fprintf(stderr, "  -framehash: Includes a hash of the final frame in the report (needs a real renderer).\n");
 	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
 						 "    parameters make up the filename. Use when the filename contains\n"
 						 "    spaces or starts with a dash.\n");
@@ -506,6 +552,13 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 				Console.WriteLn("Looping dump playback %d times.", s_loop_count);
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-startframe"))
+			{
+				const u32 start_frame = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+				GSDumpReplayer::SetStartFrame(start_frame);
+				Console.WriteLn("Starting dump playback at frame %u.", start_frame);
+				continue;
+			}
 			else if (CHECK_ARG_PARAM("-renderer"))
 			{
 				const char* rname = argv[++i];
@@ -533,6 +586,8 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 #endif
 				else if (StringUtil::Strcasecmp(rname, "sw") == 0)
 					type = GSRendererType::SW;
+				else if (StringUtil::Strcasecmp(rname, "null") == 0)
+					type = GSRendererType::Null;
 				else
 				{
 					Console.Error("Unknown renderer '%s'", rname);
@@ -541,6 +596,7 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 
 				Console.WriteLn("Using %s renderer.", Pcsx2Config::GSOptions::GetRendererName(type));
 				s_settings_interface.SetIntValue("EmuCore/GS", "Renderer", static_cast<int>(type));
+				s_renderer_specified = true;
 				continue;
 			}
 			else if (CHECK_ARG_PARAM("-renderhacks"))
@@ -599,6 +655,27 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 				s_settings_interface.SetBoolValue("EmuCore/GS", "disable_shader_cache", true);
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-frames"))
+			{
+				s_benchmark_frames = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+				if (s_benchmark_frames == 0)
+				{
+					Console.Error("Invalid frame count specified.");
+					return false;
+				}
+
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-report"))
+			{
+				s_benchmark_report_path = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG("-framehash"))
+			{
+				s_benchmark_frame_hash = true;
+				continue;
+			}
 			else if (CHECK_ARG("-window"))
 			{
 				Console.WriteLn("Creating window");
@@ -637,6 +714,30 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 		return false;
 	}
 
+	if (s_benchmark_frames > 0)
+	{
+		if (VMManager::IsGSDumpFileName(params.filename))
+		{
+			Console.Error("-frames can't be used with GS dumps.");
+			return false;
+		}
+
+		if (!s_renderer_specified)
+			s_settings_interface.SetIntValue("EmuCore/GS", "Renderer", static_cast<int>(GSRendererType::Null));
+		if (!s_use_window.has_value())
+			s_use_window = false;
+
+		// make runs reproducible, games seed their RNG from the clock
+		VMManager::Internal::SetUseConstantRTC(true);
+		Console.WriteLn("Running %u frames of '%s'.", s_benchmark_frames, params.filename.c_str());
+		return true;
+	}
+	else if (!s_benchmark_report_path.empty() || s_benchmark_frame_hash)
+	{
+		Console.Error("-report and -framehash require -frames.");
+		return false;
+	}
+
 	if (!VMManager::IsGSDumpFileName(params.filename))
 	{
 		Console.Error("Provided filename is not a GS dump.");
@@ -671,6 +772,82 @@ void GSRunner::DumpStats()
 	Console.WriteLn("============================================");
 }
 
+void GSRunner::RunBenchmark(const std::string& filename)
+{
+	{
+		std::unique_lock lock(s_benchmark_samples_mutex);
+		s_benchmark_samples.clear();
+		s_benchmark_timer.Reset();
+	}
+
+	// frame advance pauses the VM once the budget runs out
+	VMManager::FrameAdvance(s_benchmark_frames);
+	while (VMManager::GetState() == VMState::Running)
+		VMManager::Execute();
+
+	const double elapsed = s_benchmark_timer.GetTimeSeconds();
+	const u64 frames = PerformanceMetrics::GetFrameNumber();
+	const std::optional<u64> frame_hash = s_benchmark_frame_hash ? GetFinalFrameHash() : std::nullopt;
+
+	Console.WriteLn(fmt::format("@BENCH@ Frames: {} in {:.2f} seconds ({:.2f} FPS)", frames, elapsed,
+		(elapsed > 0.0) ? (static_cast<double>(frames) / elapsed) : 0.0));
+	if (frame_hash.has_value())
+		Console.WriteLn(fmt::format("@BENCH@ Frame Hash: {:016x}", frame_hash.value()));
+
+	if (!s_benchmark_report_path.empty() && !WriteBenchmarkReport(filename, elapsed, frames, frame_hash))
+		Console.Error(fmt::format("Failed to write report to '{}'.", s_benchmark_report_path));
+}
+
+std::optional<u64> GSRunner::GetFinalFrameHash()
+{
+	std::optional<u64> hash;
+	MTGS::RunOnGSThread([&hash]() {
+		u32 width, height;
+		std::vector<u32> pixels;
+		if (GSSaveSnapshotToMemory(0, 0, false, false, &width, &height, &pixels) && !pixels.empty())
+			hash = GSXXH3_64bits(pixels.data(), pixels.size() * sizeof(u32));
+	});
+	MTGS::WaitGS(false);
+
+	if (!hash.has_value())
+		Console.Warning("Final frame is not available for hashing, is the null renderer in use?");
+
+	return hash;
+}
+
+bool GSRunner::WriteBenchmarkReport(const std::string& filename, double elapsed, u64 frames, std::optional<u64> frame_hash)
+{
+	std::string json;
+	json += "{\n";
+	json += fmt::format("\t\"filename\": {},\n", StringUtil::JSONString(filename));
+	json += fmt::format("\t\"serial\": {},\n", StringUtil::JSONString(VMManager::GetDiscSerial()));
+	json += fmt::format("\t\"crc\": \"{:08X}\",\n", VMManager::GetDiscCRC());
+	json += fmt::format("\t\"version\": {},\n", StringUtil::JSONString(GIT_REV));
+	json += fmt::format("\t\"renderer\": \"{}\",\n", Pcsx2Config::GSOptions::GetRendererName(GSConfig.Renderer));
+	json += fmt::format("\t\"frames\": {},\n", frames);
+	json += fmt::format("\t\"elapsed_seconds\": {:.3f},\n", elapsed);
+	json += fmt::format("\t\"average_fps\": {:.2f},\n", (elapsed > 0.0) ? (static_cast<double>(frames) / elapsed) : 0.0);
+	if (frame_hash.has_value())
+		json += fmt::format("\t\"frame_hash\": \"{:016x}\",\n", frame_hash.value());
+	else
+		json += "\t\"frame_hash\": null,\n";
+
+	std::unique_lock lock(s_benchmark_samples_mutex);
+	json += "\t\"samples\": [";
+	for (size_t i = 0; i < s_benchmark_samples.size(); i++)
+	{
+		const BenchmarkSample& sample = s_benchmark_samples[i];
+		json += fmt::format("{}\n\t\t{{\"time\": {:.3f}, \"frame\": {}, \"fps\": {:.2f}, \"speed\": {:.2f}, "
+							"\"ee_usage\": {:.2f}, \"gs_usage\": {:.2f}, \"vu_usage\": {:.2f}, \"iop_mhz\": {:.2f}}}",
+			(i > 0) ? "," : "", sample.time, sample.frame, sample.fps, sample.speed, sample.ee_usage, sample.gs_usage,
+			sample.vu_usage, sample.iop_mhz);
+	}
+	json += "\n\t]\n}\n";
+	lock.unlock();
+
+	return FileSystem::WriteStringToFile(s_benchmark_report_path.c_str(), json);
+}
+
 #ifdef _WIN32
 // We can't handle unicode in filenames if we don't use wmain on Win32.
 #define main real_main
@@ -706,13 +883,21 @@ int main(int argc, char* argv[])
 
 	if (VMManager::Initialize(params))
 	{
-		// run until end
-		GSDumpReplayer::SetLoopCount(s_loop_count);
-		VMManager::SetState(VMState::Running);
-		while (VMManager::GetState() == VMState::Running)
-			VMManager::Execute();
-		VMManager::Shutdown(false);
-		GSRunner::DumpStats();
+		if (s_benchmark_frames > 0)
+		{
+			GSRunner::RunBenchmark(params.filename);
+			VMManager::Shutdown(false);
+		}
+		else
+		{
+			// run until end
+			GSDumpReplayer::SetLoopCount(s_loop_count);
+			VMManager::SetState(VMState::Running);
+			while (VMManager::GetState() == VMState::Running)
+				VMManager::Execute();
+			VMManager::Shutdown(false);
+			GSRunner::DumpStats();
+		}
 	}
 
 	VMManager::Internal::CPUThreadShutdown();
@@ -15,11 +15,13 @@
 #include "pcsx2/CDVD/CDVDcommon.h"
 #include "pcsx2/Achievements.h"
 #include "pcsx2/CDVD/CDVD.h"
+#include "pcsx2/CDVD/IsoHasher.h"
 #include "pcsx2/Counters.h"
 #include "pcsx2/DebugTools/Debug.h"
 #include "pcsx2/GS.h"
 #include "pcsx2/GS/GS.h"
 #include "pcsx2/GSDumpReplayer.h"
+#include "pcsx2/GameDatabase.h"
 #include "pcsx2/GameList.h"
 #include "pcsx2/Host.h"
 #include "pcsx2/INISettingsInterface.h"
@@ -77,6 +79,7 @@ namespace QtHost
 	static void HookSignals();
 	static void RegisterTypes();
 	static bool RunSetupWizard();
+	static int RunImageVerification();
 	static std::optional<bool> DownloadFile(QWidget* parent, const QString& title, std::string url, std::vector<u8>* data);
 } // namespace QtHost
 
@@ -93,6 +96,7 @@ static bool s_test_config_and_exit = false;
 static bool s_run_setup_wizard = false;
 static bool s_cleanup_after_update = false;
 static bool s_boot_and_debug = false;
+static std::vector<std::string> s_verify_images;
 
 //////////////////////////////////////////////////////////////////////////
 // CPU Thread
@@ -2048,6 +2052,9 @@ void QtHost::PrintCommandLineHelp(const std::string_view progname)
 	std::fprintf(stderr, "  -testconfig: Initializes configuration and checks version, then exits.\n");
 	std::fprintf(stderr, "  -setupwizard: Forces initial setup wizard to run.\n");
 	std::fprintf(stderr, "  -debugger: Open debugger and break on entry point.\n");
+	std::fprintf(stderr, "  -verify <filename>: Hashes the image (MD5/SHA1/CRC32), checks it against the redump\n"
+						 "    database, prints a JSON report to stdout and exits. Can be given multiple times.\n"
+						 "    Exits with a non-zero code if any image could not be verified.\n");
 #ifdef ENABLE_RAINTEGRATION
 	std::fprintf(stderr, "  -raintegration: Use RAIntegration instead of built-in achievement support.\n");
 #endif
@@ -2185,6 +2192,11 @@ bool QtHost::ParseCommandLineOptions(const QStringList& args, std::shared_ptr<VM
 				s_boot_and_debug = true;
 				continue;
 			}
+			else if (CHECK_ARG_PARAM(QStringLiteral("-verify")))
+			{
+				s_verify_images.push_back((++it)->toStdString());
+				continue;
+			}
 			else if (CHECK_ARG(QStringLiteral("-updatecleanup")))
 			{
 				s_cleanup_after_update = AutoUpdaterDialog::isSupported();
@@ -2228,7 +2240,7 @@ bool QtHost::ParseCommandLineOptions(const QStringList& args, std::shared_ptr<VM
 
 	// if we don't have autoboot, we definitely don't want batch mode (because that'll skip
 	// scanning the game list).
-	if (s_batch_mode && !s_start_fullscreen_ui && !autoboot)
+	if (s_batch_mode && s_verify_images.empty() && !s_start_fullscreen_ui && !autoboot)
 	{
 		QMessageBox::critical(nullptr, QStringLiteral("Error"),
 			s_nogui_mode ? QStringLiteral("Cannot use no-gui mode, because no boot filename was specified.") :
@@ -2288,6 +2300,86 @@ bool QtHost::RunSetupWizard()
 	return true;
 }
 
+int QtHost::RunImageVerification()
+{
+	int result = EXIT_SUCCESS;
+	std::string report = "{\n  \"images\": [";
+
+	for (size_t image_index = 0; image_index < s_verify_images.size(); image_index++)
+	{
+		const std::string& path = s_verify_images[image_index];
+		report.append(image_index ? ",\n    {\n" : "\n    {\n");
+		report.append(fmt::format("      \"path\": {},\n", StringUtil::JSONString(path)));
+
+		Common::Timer timer;
+		IsoHasher hasher;
+		Error error;
+		if (!hasher.Open(path, &error))
+		{
+			report.append(fmt::format("      \"error\": {}\n    }}", StringUtil::JSONString(error.GetDescription())));
+			result = EXIT_FAILURE;
+			continue;
+		}
+
+		hasher.ComputeHashes(ProgressCallback::NullProgressCallback,
+			IsoHasher::HASH_MD5 | IsoHasher::HASH_SHA1 | IsoHasher::HASH_CRC32);
+
+		std::vector<GameDatabase::TrackHash> thashes;
+		thashes.reserve(hasher.GetTrackCount());
+		for (const IsoHasher::Track& track : hasher.GetTracks())
+		{
+			GameDatabase::TrackHash thash;
+			thash.size = track.size;
+			if (track.hash.empty() || !thash.parseHash(track.hash))
+				break;
+
+			thashes.push_back(thash);
+		}
+
+		std::unique_ptr<bool[]> val_results = std::make_unique<bool[]>(hasher.GetTrackCount());
+		std::string match_error;
+		const GameDatabase::HashDatabaseEntry* hentry = nullptr;
+		if (thashes.size() == hasher.GetTrackCount())
+		{
+			hentry = GameDatabase::lookupHash(thashes.data(), thashes.size(), val_results.get(), &match_error);
+		}
+		else
+		{
+			match_error = "Failed to read one or more tracks.";
+			result = EXIT_FAILURE;
+		}
+
+		report.append(fmt::format("      \"verified\": {},\n", hentry ? "true" : "false"));
+		if (hentry)
+		{
+			report.append(fmt::format("      \"serial\": {},\n      \"name\": {},\n      \"version\": {},\n",
+				StringUtil::JSONString(hentry->serial), StringUtil::JSONString(hentry->name), StringUtil::JSONString(hentry->version)));
+		}
+		else
+		{
+			report.append(fmt::format("      \"match_error\": {},\n", StringUtil::JSONString(match_error)));
+			result = EXIT_FAILURE;
+		}
+
+		report.append("      \"tracks\": [");
+		for (u32 i = 0; i < hasher.GetTrackCount(); i++)
+		{
+			const IsoHasher::Track& track = hasher.GetTrack(i);
+			report.append(fmt::format("{}\n        {{\"number\": {}, \"type\": {}, \"start_lsn\": {}, \"sectors\": {}, "
+									  "\"size\": {}, \"md5\": {}, \"sha1\": {}, \"crc32\": {}, \"matched\": {}}}",
+				i ? "," : "", track.number, StringUtil::JSONString(IsoHasher::GetTrackTypeString(track.type)), track.start_lsn,
+				track.sectors, track.size, StringUtil::JSONString(track.hash), StringUtil::JSONString(track.sha1), StringUtil::JSONString(track.crc32),
+				(thashes.size() == hasher.GetTrackCount() && val_results[i]) ? "true" : "false"));
+		}
+		report.append(fmt::format("\n      ],\n      \"time_ms\": {:.1f}\n    }}", timer.GetTimeMilliseconds()));
+	}
+
+	report.append("\n  ]\n}\n");
+	std::fputs(report.c_str(), stdout);
+	std::fflush(stdout);
+	return result;
+}
+
 int main(int argc, char* argv[])
 {
 	CrashHandler::Install();
@@ -2314,6 +2406,10 @@ int main(int argc, char* argv[])
 	if (s_test_config_and_exit)
 		return EXIT_SUCCESS;
 
+	// Headless image verification doesn't need any windows or the CPU thread.
+	if (!s_verify_images.empty())
+		return QtHost::RunImageVerification();
+
 	// Remove any previous-version remanants.
 	if (s_cleanup_after_update)
 		AutoUpdaterDialog::cleanupAfterUpdate();
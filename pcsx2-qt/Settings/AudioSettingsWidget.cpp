@@ -447,6 +447,10 @@ void AudioSettingsWidget::onStretchSettingsClicked()
 		AudioStreamParameters::DEFAULT_STRETCH_USE_QUICKSEEK);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, dlgui.useAAFilter, "SPU2/Output", "StretchUseAAFilter",
 		AudioStreamParameters::DEFAULT_STRETCH_USE_AA_FILTER);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, dlgui.adaptiveLatency, "SPU2/Output", "StretchAdaptiveLatency",
+		AudioStreamParameters::DEFAULT_STRETCH_ADAPTIVE_LATENCY);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, dlgui.lowLatency, "SPU2/Output", "StretchLowLatency",
+		AudioStreamParameters::DEFAULT_STRETCH_LOW_LATENCY);
 
 	connect(dlgui.buttonBox->button(QDialogButtonBox::Close), &QPushButton::clicked, &dlg, &QDialog::accept);
 	connect(dlgui.buttonBox->button(QDialogButtonBox::RestoreDefaults), &QPushButton::clicked, this, [this, &dlg]() {
@@ -470,6 +474,14 @@ void AudioSettingsWidget::onStretchSettingsClicked()
 			m_dialog->isPerGameSettings() ?
 				std::nullopt :
 				std::optional<bool>(AudioStreamParameters::DEFAULT_STRETCH_USE_AA_FILTER));
+		m_dialog->setBoolSettingValue("SPU2/Output", "StretchAdaptiveLatency",
+			m_dialog->isPerGameSettings() ?
+				std::nullopt :
+				std::optional<bool>(AudioStreamParameters::DEFAULT_STRETCH_ADAPTIVE_LATENCY));
+		m_dialog->setBoolSettingValue("SPU2/Output", "StretchLowLatency",
+			m_dialog->isPerGameSettings() ?
+				std::nullopt :
+				std::optional<bool>(AudioStreamParameters::DEFAULT_STRETCH_LOW_LATENCY));
 
 		dlg.done(0);
 
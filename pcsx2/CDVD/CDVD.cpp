@@ -919,9 +919,9 @@ void cdvdReset()
 
 	// If we are recording, always use the same RTC setting
 	// for games that use the RTC to seed their RNG -- this is very important to be the same everytime!
-	if (g_InputRecording.isActive())
+	if (g_InputRecording.isActive() || VMManager::Internal::IsUsingConstantRTC())
 	{
-		Console.WriteLn("Input Recording Active - Using Constant RTC of 04-03-2020 (DD-MM-YYYY)");
+		Console.WriteLn("Using Constant RTC of 04-03-2020 (DD-MM-YYYY)");
 		// Why not just 0 everything? Some games apparently require the date to be valid in terms of when
 		// the PS2 / Game actually came out. (MGS3).  So set it to a value well beyond any PS2 game's release date.
 		cdvd.RTC.second = 0;
@@ -7,11 +7,119 @@
 
 #include "common/Error.h"
 #include "common/MD5Digest.h"
+#include "common/SHA1Digest.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 
 #include "fmt/core.h"
 
+#include <zlib.h>
+
 #include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	// Sectors are read on the calling thread into a small ring of chunks, and every hasher consumes
+	// each chunk on its own thread. A chunk is reused once all hashers are done with it, so reading
+	// the next chunk overlaps with hashing the previous ones.
+	class HashPipeline
+	{
+	public:
+		static constexpr u32 NUM_CHUNKS = 4;
+		static constexpr u32 SECTORS_PER_CHUNK = 128;
+
+		using HashFunction = std::function<void(const u8*, u32)>;
+
+		HashPipeline(u32 sector_size)
+		{
+			for (std::vector<u8>& chunk : m_chunks)
+				chunk.resize(sector_size * SECTORS_PER_CHUNK);
+		}
+
+		~HashPipeline()
+		{
+			Finish(true);
+		}
+
+		void Start(std::vector<HashFunction> hashers)
+		{
+			m_num_hashers = static_cast<u32>(hashers.size());
+			for (HashFunction& fn : hashers)
+				m_threads.emplace_back(&HashPipeline::HasherThread, this, std::move(fn));
+		}
+
+		u8* BeginWrite()
+		{
+			std::unique_lock lock(m_mutex);
+			const u32 slot = static_cast<u32>(m_produced % NUM_CHUNKS);
+			m_free_cv.wait(lock, [this, slot]() { return m_pending[slot] == 0; });
+			return m_chunks[slot].data();
+		}
+
+		void EndWrite(u32 size)
+		{
+			std::unique_lock lock(m_mutex);
+			const u32 slot = static_cast<u32>(m_produced % NUM_CHUNKS);
+			m_sizes[slot] = size;
+			m_pending[slot] = m_num_hashers;
+			m_produced++;
+			m_data_cv.notify_all();
+		}
+
+		void Finish(bool abort)
+		{
+			{
+				std::unique_lock lock(m_mutex);
+				m_finished = true;
+				m_aborted |= abort;
+				m_data_cv.notify_all();
+			}
+
+			for (std::thread& thread : m_threads)
+				thread.join();
+			m_threads.clear();
+		}
+
+	private:
+		void HasherThread(HashFunction fn)
+		{
+			Threading::SetNameOfCurrentThread("ISO Hasher");
+
+			std::unique_lock lock(m_mutex);
+			for (u64 next = 0;; next++)
+			{
+				m_data_cv.wait(lock, [this, next]() { return next < m_produced || m_finished; });
+				if (m_aborted || next == m_produced)
+					break;
+
+				const u32 slot = static_cast<u32>(next % NUM_CHUNKS);
+				lock.unlock();
+				fn(m_chunks[slot].data(), m_sizes[slot]);
+				lock.lock();
+
+				if (--m_pending[slot] == 0)
+					m_free_cv.notify_one();
+			}
+		}
+
+		std::array<std::vector<u8>, NUM_CHUNKS> m_chunks;
+		std::array<u32, NUM_CHUNKS> m_sizes = {};
+		std::array<u32, NUM_CHUNKS> m_pending = {};
+		std::vector<std::thread> m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_data_cv;
+		std::condition_variable m_free_cv;
+		u64 m_produced = 0;
+		u32 m_num_hashers = 0;
+		bool m_finished = false;
+		bool m_aborted = false;
+	};
+} // namespace
 
 IsoHasher::IsoHasher() = default;
 
@@ -112,7 +220,7 @@ void IsoHasher::Close()
 	m_is_open = false;
 }
 
-void IsoHasher::ComputeHashes(ProgressCallback* callback)
+void IsoHasher::ComputeHashes(ProgressCallback* callback, u32 hash_types)
 {
 	callback->SetProgressRange(GetTrackCount());
 	callback->SetProgressValue(0);
@@ -121,14 +229,15 @@ void IsoHasher::ComputeHashes(ProgressCallback* callback)
 	for (u32 index = 0; index < GetTrackCount(); index++)
 	{
 		Track& track = m_tracks[index];
-		if (!track.hash.empty())
+		if (((hash_types & HASH_MD5) == 0 || !track.hash.empty()) && ((hash_types & HASH_SHA1) == 0 || !track.sha1.empty()) &&
+			((hash_types & HASH_CRC32) == 0 || !track.crc32.empty()))
 		{
 			callback->SetProgressValue(index + 1);
 			continue;
 		}
 
 		callback->PushState();
-		const bool result = ComputeTrackHash(track, callback);
+		const bool result = ComputeTrackHash(track, hash_types, callback);
 		callback->PopState();
 
 		if (!result)
@@ -141,42 +250,72 @@ void IsoHasher::ComputeHashes(ProgressCallback* callback)
 	callback->SetProgressValue(GetTrackCount());
 }
 
-bool IsoHasher::ComputeTrackHash(Track& track, ProgressCallback* callback)
+bool IsoHasher::ComputeTrackHash(Track& track, u32 hash_types, ProgressCallback* callback)
 {
 	// use 2048 byte reads for DVDs, otherwise 2352 raw.
 	const int read_mode = m_is_cd ? CDVD_MODE_2352 : CDVD_MODE_2048;
 	const u32 sector_size = m_is_cd ? 2352 : 2048;
-	std::vector<u8> sector_buffer(sector_size);
 
 	const u32 update_interval = std::max<u32>(track.sectors / 100u, 1u);
 	callback->SetFormattedStatusText("Computing hash for track %u...", track.number);
 	callback->SetProgressRange(track.sectors);
 
 	MD5Digest md5;
-	for (u32 i = 0; i < track.sectors; i++)
+	SHA1Digest sha1;
+	uLong crc = crc32(0L, Z_NULL, 0);
+
+	std::vector<HashPipeline::HashFunction> hashers;
+	if (hash_types & HASH_MD5)
+		hashers.emplace_back([&md5](const u8* data, u32 size) { md5.Update(data, size); });
+	if (hash_types & HASH_SHA1)
+		hashers.emplace_back([&sha1](const u8* data, u32 size) { sha1.Update(data, size); });
+	if (hash_types & HASH_CRC32)
+		hashers.emplace_back([&crc](const u8* data, u32 size) { crc = crc32(crc, data, size); });
+
+	HashPipeline pipeline(sector_size);
+	pipeline.Start(std::move(hashers));
+
+	for (u32 i = 0; i < track.sectors;)
 	{
 		if (callback->IsCancelled())
 			return false;
 
-		const u32 lsn = track.start_lsn + i;
-		if (DoCDVDreadSector(sector_buffer.data(), lsn, read_mode) != 0)
+		u8* chunk = pipeline.BeginWrite();
+		const u32 chunk_sectors = std::min(track.sectors - i, HashPipeline::SECTORS_PER_CHUNK);
+		for (u32 j = 0; j < chunk_sectors; j++)
 		{
-			callback->DisplayFormattedModalError("Read error at LSN %u", lsn);
-			return false;
+			const u32 lsn = track.start_lsn + i + j;
+			if (DoCDVDreadSector(chunk + j * sector_size, lsn, read_mode) != 0)
+			{
+				callback->DisplayFormattedModalError("Read error at LSN %u", lsn);
+				return false;
+			}
 		}
 
-		md5.Update(sector_buffer.data(), sector_size);
+		pipeline.EndWrite(chunk_sectors * sector_size);
 
-		if ((i % update_interval) == 0)
+		if ((i / update_interval) != ((i + chunk_sectors) / update_interval))
 			callback->SetProgressValue(i);
+
+		i += chunk_sectors;
 	}
 
-	u8 digest[16];
-	md5.Final(digest);
-	track.hash =
-		fmt::format("{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}{:02x}",
-			digest[0], digest[1], digest[2], digest[3], digest[4], digest[5], digest[6], digest[7], digest[8],
-			digest[9], digest[10], digest[11], digest[12], digest[13], digest[14], digest[15]);
+	pipeline.Finish(false);
+
+	if (hash_types & HASH_MD5)
+	{
+		u8 digest[16];
+		md5.Final(digest);
+		track.hash = StringUtil::EncodeHex(digest, sizeof(digest));
+	}
+	if (hash_types & HASH_SHA1)
+	{
+		u8 digest[SHA1Digest::DIGEST_SIZE];
+		sha1.Final(digest);
+		track.sha1 = StringUtil::EncodeHex(digest, sizeof(digest));
+	}
+	if (hash_types & HASH_CRC32)
+		track.crc32 = fmt::format("{:08x}", static_cast<u32>(crc));
 
 	callback->SetProgressValue(track.sectors);
 	return true;
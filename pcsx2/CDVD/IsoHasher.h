@@ -14,6 +14,13 @@ class Error;
 class IsoHasher
 {
 public:
+	enum HashType : u32
+	{
+		HASH_MD5 = (1 << 0),
+		HASH_SHA1 = (1 << 1),
+		HASH_CRC32 = (1 << 2),
+	};
+
 	struct Track
 	{
 		u32 number;
@@ -21,7 +28,9 @@ public:
 		u32 start_lsn;
 		u32 sectors;
 		u64 size;
-		std::string hash;
+		std::string hash; // MD5, the format used by the redump database.
+		std::string sha1;
+		std::string crc32;
 	};
 
 public:
@@ -38,10 +47,12 @@ public:
 	bool Open(std::string iso_path, Error* error = nullptr);
 	void Close();
 
-	void ComputeHashes(ProgressCallback* callback = ProgressCallback::NullProgressCallback);
+	/// Computes the requested hashes for every track in a single pass over the image. Sector reads
+	/// are overlapped with hashing, and each hash type runs on its own thread.
+	void ComputeHashes(ProgressCallback* callback = ProgressCallback::NullProgressCallback, u32 hash_types = HASH_MD5);
 
 private:
-	bool ComputeTrackHash(Track& track, ProgressCallback* callback);
+	bool ComputeTrackHash(Track& track, u32 hash_types, ProgressCallback* callback);
 
 	std::vector<Track> m_tracks;
 	bool m_is_open = false;
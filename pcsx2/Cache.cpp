@@ -163,6 +163,23 @@ void resetCache()
 	std::memset(&cache, 0, sizeof(cache));
 }
 
+CacheRecInfo getCacheRecInfo()
+{
+	CacheRecInfo info;
+	info.sets = cache.sets;
+	info.set_stride = sizeof(CacheSet);
+	for (int way = 0; way < 2; way++)
+	{
+		info.tag_offset[way] = static_cast<u32>(offsetof(CacheSet, tags) + sizeof(CacheTag) * way + offsetof(CacheTag, rawValue));
+		info.data_offset[way] = static_cast<u32>(offsetof(CacheSet, data) + sizeof(CacheData) * way);
+	}
+	info.addr_mask = ~static_cast<uptr>(CacheTag::ALL_FLAGS);
+	info.dirty_flag = CacheTag::DIRTY_FLAG;
+	info.valid_flag = CacheTag::VALID_FLAG;
+	info.lock_flag = CacheTag::LOCK_FLAG;
+	return info;
+}
+
 static bool findInCache(const CacheSet& set, uptr ppf, int* way)
 {
 	auto check = [&](int checkWay) -> bool {
@@ -18,3 +18,17 @@ u16 readCache16(u32 mem, bool validPFN = true);
 u32 readCache32(u32 mem, bool validPFN = true);
 u64 readCache64(u32 mem, bool validPFN = true);
 RETURNS_R128 readCache128(u32 mem, bool validPFN = true);
+
+// Raw layout of the cache, so the recompiler can check the tags without calling in here.
+struct CacheRecInfo
+{
+	void* sets;
+	u32 set_stride;
+	u32 tag_offset[2];
+	u32 data_offset[2];
+	uptr addr_mask;
+	uptr dirty_flag;
+	uptr valid_flag;
+	uptr lock_flag;
+};
+CacheRecInfo getCacheRecInfo();
@@ -174,6 +174,7 @@ enum GamefixId
 	Fix_XGKick,
 	Fix_BlitInternalFPS,
 	Fix_FullVU0Sync,
+	Fix_EECache,
 
 	GamefixId_COUNT
 };
@@ -527,6 +528,8 @@ struct Pcsx2Config
 			EnableEECache : 1;
 		bool
 			EnableFastmem : 1;
+		bool
+			EnableEESuperblocks : 1;
 		bool
 			PauseOnTLBMiss : 1;
 		BITFIELD_END
@@ -733,6 +736,8 @@ struct Pcsx2Config
 		int SaveN = 0;
 		int SaveL = 5000;
 
+		u32 GSDumpKeyframeInterval = 0;
+
 		s8 ExclusiveFullscreenControl = -1;
 		GSScreenshotSize ScreenshotSize = GSScreenshotSize::WindowResolution;
 		GSScreenshotFormat ScreenshotFormat = GSScreenshotFormat::PNG;
@@ -885,6 +890,8 @@ struct Pcsx2Config
 
 		bool HddEnable{false};
 		std::string HddFile;
+		// If set, HddFile is opened read only and writes go to this copy-on-write overlay
+		std::string HddOverlayFile;
 
 		DEV9Options();
 
@@ -921,7 +928,8 @@ struct Pcsx2Config
 			VUOverflowHack : 1, // Tries to simulate overflow flag checks (not really possible on x86 without soft floats)
 			XgKickHack : 1, // Erementar Gerad, adds more delay to VU XGkick instructions. Corrects the color of some graphics, but breaks Tri-ace games and others.
 			BlitInternalFPSHack : 1, // Disables privileged register write-based FPS detection.
-			FullVU0SyncHack : 1; // Forces tight VU0 sync on every COP2 instruction.
+			FullVU0SyncHack : 1, // Forces tight VU0 sync on every COP2 instruction.
+			EECacheHack : 1; // Enables EE data cache emulation for games which depend on it.
 		BITFIELD_END
 
 		GamefixOptions();
@@ -1266,9 +1274,9 @@ namespace EmuFolders
 #endif
 #define INSTANT_VU1 (EmuConfig.Speedhacks.vu1Instant)
 #define CHECK_EEREC (EmuConfig.Cpu.Recompiler.EnableEE)
-#define CHECK_CACHE (EmuConfig.Cpu.Recompiler.EnableEECache)
+#define CHECK_CACHE (EmuConfig.Cpu.Recompiler.EnableEECache || EmuConfig.Gamefixes.EECacheHack)
 #define CHECK_IOPREC (EmuConfig.Cpu.Recompiler.EnableIOP)
-#define CHECK_FASTMEM (EmuConfig.Cpu.Recompiler.EnableEE && EmuConfig.Cpu.Recompiler.EnableFastmem)
+#define CHECK_FASTMEM (EmuConfig.Cpu.Recompiler.EnableEE && EmuConfig.Cpu.Recompiler.EnableFastmem && !CHECK_CACHE)
 #define CHECK_EXTRAMEM (memGetExtraMemMode())
 
 //------------ SPECIAL GAME FIXES!!! ---------------
@@ -8,11 +8,15 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "common/RedtapeWindows.h"
 #include "common/Path.h"
 
 #include "DEV9/SimpleQueue.h"
+#include "HddOverlay.h"
 
 class ATA
 {
@@ -27,6 +31,8 @@ private:
 	std::FILE* hddImage = nullptr;
 	u64 hddImageSize;
 
+	std::unique_ptr<HddOverlay> hddOverlay;
+
 	bool hddSparse = false;
 	u64 hddSparseBlockSize;
 	u64 HddSparseStart;
@@ -122,9 +128,29 @@ private:
 	std::atomic_bool ioClose{false};
 	bool ioWrite;
 	bool ioRead;
+	bool ioReadahead = false;
+	u64 readaheadPos = 0;
 	void (ATA::*waitingCmd)() = nullptr;
 	//Write Buffer(s)
 
+	//Read Cache
+	//Only accessed from the ioThread, or while it is idle
+	static constexpr u32 cacheBlockSize = 64 * 1024;
+	static constexpr u32 cacheBlockCount = 256; //16MB
+	static constexpr u32 readaheadBlocks = 8; //512KB
+	struct CacheBlock
+	{
+		u64 block = UINT64_MAX;
+		u64 lastUse = 0;
+	};
+	std::unique_ptr<u8[]> cacheData;
+	std::vector<CacheBlock> cacheBlocks;
+	std::unordered_map<u64, u32> cacheLookup;
+	u64 cacheUseCounter = 0;
+	//Byte offset after the last read, to detect sequential reads
+	u64 lastReadEnd = UINT64_MAX;
+	//Read Cache
+
 	//Read Buffer
 	int rdTransferred = 0;
 	int wrTransferred = 0;
@@ -155,7 +181,7 @@ public:
 	ATA();
 	~ATA();
 
-	int Open(const std::string& hddPath);
+	int Open(const std::string& hddPath, const std::string& overlayPath);
 	void Close();
 
 	void ATA_HardReset();
@@ -206,6 +232,11 @@ private:
 	void IO_Thread();
 	void IO_Read();
 	bool IO_Write();
+	void IO_Readahead();
+	bool IO_ReadImage(u64 byteOffset, u8* data, u64 byteSize);
+	void IO_CacheReset();
+	u8* IO_CacheGetBlock(u64 block);
+	void IO_CacheUpdate(u64 byteOffset, const u8* data, u64 byteSize);
 	bool IO_SparseZero(u64 byteOffset, u64 byteSize);
 	void IO_SparseCacheUpdateLocation(u64 Offset);
 	void IO_SparseCacheLoad();
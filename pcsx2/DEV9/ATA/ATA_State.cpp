@@ -34,7 +34,7 @@ ATA::~ATA()
 		std::fclose(hddImage);
 }
 
-int ATA::Open(const std::string& hddPath)
+int ATA::Open(const std::string& hddPath, const std::string& overlayPath)
 {
 	readBufferLen = 256 * 512;
 	readBuffer = new u8[readBufferLen];
@@ -46,7 +46,8 @@ int ATA::Open(const std::string& hddPath)
 	if (!FileSystem::FileExists(hddPath.c_str()))
 		return -1;
 
-	hddImage = FileSystem::OpenCFile(hddPath.c_str(), "r+b");
+	//With an overlay, the base image is shared and never written to
+	hddImage = FileSystem::OpenCFile(hddPath.c_str(), overlayPath.empty() ? "r+b" : "rb");
 	const s64 size = hddImage ? FileSystem::FSize64(hddImage) : -1;
 	if (!hddImage || size < 0)
 	{
@@ -99,12 +100,28 @@ int ATA::Open(const std::string& hddPath)
 
 	CreateHDDinfo(hddImageSize / 512);
 
-	InitSparseSupport(hddPath);
+	if (!overlayPath.empty())
+	{
+		DevCon.WriteLn("DEV9: ATA: HddOverlay : %s", overlayPath.c_str());
+		hddOverlay = std::make_unique<HddOverlay>();
+		if (!hddOverlay->Open(overlayPath, hddImage, hddImageSize))
+		{
+			hddOverlay.reset();
+			std::fclose(hddImage);
+			hddImage = nullptr;
+			return -1;
+		}
+	}
+	else
+		InitSparseSupport(hddPath);
+
+	IO_CacheReset();
 
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
 		ioWrite = false;
+		ioReadahead = false;
 	}
 
 	ioThread = std::thread(&ATA::IO_Thread, this);
@@ -281,12 +298,21 @@ void ATA::Close()
 		hddSparseBlock = nullptr;
 		hddSparseBlockValid = false;
 	}
+	if (hddOverlay)
+	{
+		hddOverlay->Close();
+		hddOverlay.reset();
+	}
 	if (hddImage)
 	{
 		std::fclose(hddImage);
 		hddImage = nullptr;
 	}
 
+	cacheData = nullptr;
+	cacheBlocks.clear();
+	cacheLookup.clear();
+
 	delete[] readBuffer;
 	readBuffer = nullptr;
 }
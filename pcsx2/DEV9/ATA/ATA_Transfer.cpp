@@ -25,7 +25,7 @@ void ATA::IO_Thread()
 		ioThreadIdle_bool = true;
 		ioThreadIdle_cv.notify_all();
 
-		ioReady.wait(ioWaitHandle, [&] { return ioRead | ioWrite; });
+		ioReady.wait(ioWaitHandle, [&] { return ioRead | ioWrite | ioReadahead; });
 		ioThreadIdle_bool = false;
 
 		int ioType = -1;
@@ -33,6 +33,8 @@ void ATA::IO_Thread()
 			ioType = 0;
 		else if (ioWrite)
 			ioType = 1;
+		else if (ioReadahead)
+			ioType = 2;
 
 		ioWaitHandle.unlock();
 
@@ -53,6 +55,8 @@ void ATA::IO_Thread()
 				}
 			}
 		}
+		else if (ioType == 2)
+			IO_Readahead();
 	}
 }
 
@@ -67,17 +71,149 @@ void ATA::IO_Read()
 		abort();
 	}
 
+	//Queued writes must reach the image (and cache) first
+	while (IO_Write())
+	{
+	}
+
 	const u64 pos = lba * 512;
-	if (FileSystem::FSeek64(hddImage, pos, SEEK_SET) != 0 ||
-		std::fread(readBuffer,  512, nsector, hddImage) != static_cast<size_t>(nsector))
+	const u64 size = static_cast<u64>(nsector) * 512;
+	u64 done = 0;
+	while (done < size)
 	{
-		Console.Error("DEV9: ATA: File read error");
-		pxAssert(false);
-		abort();
+		const u64 block = (pos + done) / cacheBlockSize;
+		const u64 blockPos = (pos + done) % cacheBlockSize;
+		const u64 readSize = std::min<u64>(cacheBlockSize - blockPos, size - done);
+
+		const u8* blockData = IO_CacheGetBlock(block);
+		if (blockData == nullptr)
+		{
+			Console.Error("DEV9: ATA: File read error");
+			pxAssert(false);
+			abort();
+		}
+
+		memcpy(&readBuffer[done], &blockData[blockPos], readSize);
+		done += readSize;
 	}
+
+	//Sequential reads get the following blocks fetched in the background
+	const bool sequential = (pos == lastReadEnd);
+	lastReadEnd = pos + size;
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
+		if (sequential)
+		{
+			readaheadPos = pos + size;
+			ioReadahead = true;
+		}
+	}
+	if (sequential)
+		ioReady.notify_all();
+}
+
+void ATA::IO_Readahead()
+{
+	u64 pos;
+	{
+		std::lock_guard ioSignallock(ioMutex);
+		pos = readaheadPos;
+	}
+
+	const u64 firstBlock = pos / cacheBlockSize;
+	for (u64 block = firstBlock; block < firstBlock + readaheadBlocks; block++)
+	{
+		if (block * cacheBlockSize >= hddImageSize)
+			break;
+
+		{
+			//Give way to real reads and writes
+			std::lock_guard ioSignallock(ioMutex);
+			if (!ioReadahead || ioRead || ioWrite)
+				break;
+		}
+
+		//Errors are reported when the data is actually read
+		if (IO_CacheGetBlock(block) == nullptr)
+			break;
+	}
+
+	std::lock_guard ioSignallock(ioMutex);
+	ioReadahead = false;
+}
+
+bool ATA::IO_ReadImage(u64 byteOffset, u8* data, u64 byteSize)
+{
+	if (hddOverlay)
+		return hddOverlay->Read(byteOffset, data, byteSize);
+
+	return FileSystem::FSeek64(hddImage, byteOffset, SEEK_SET) == 0 &&
+		   std::fread(data, byteSize, 1, hddImage) == 1;
+}
+
+void ATA::IO_CacheReset()
+{
+	cacheData = std::make_unique<u8[]>(static_cast<size_t>(cacheBlockCount) * cacheBlockSize);
+	cacheBlocks.assign(cacheBlockCount, CacheBlock{});
+	cacheLookup.clear();
+	cacheLookup.reserve(cacheBlockCount);
+	cacheUseCounter = 0;
+	lastReadEnd = UINT64_MAX;
+}
+
+u8* ATA::IO_CacheGetBlock(u64 block)
+{
+	const auto it = cacheLookup.find(block);
+	if (it != cacheLookup.end())
+	{
+		cacheBlocks[it->second].lastUse = ++cacheUseCounter;
+		return &cacheData[static_cast<size_t>(it->second) * cacheBlockSize];
+	}
+
+	//Evict least recently used (unused entries have lastUse 0)
+	u32 victim = 0;
+	for (u32 i = 1; i < cacheBlockCount; i++)
+	{
+		if (cacheBlocks[i].lastUse < cacheBlocks[victim].lastUse)
+			victim = i;
+	}
+
+	if (cacheBlocks[victim].block != UINT64_MAX)
+	{
+		cacheLookup.erase(cacheBlocks[victim].block);
+		cacheBlocks[victim] = CacheBlock{};
+	}
+
+	u8* data = &cacheData[static_cast<size_t>(victim) * cacheBlockSize];
+	const u64 pos = block * cacheBlockSize;
+	const u64 size = std::min<u64>(cacheBlockSize, hddImageSize - pos);
+	if (!IO_ReadImage(pos, data, size))
+		return nullptr;
+	if (size < cacheBlockSize)
+		memset(&data[size], 0, cacheBlockSize - size);
+
+	cacheBlocks[victim] = {block, ++cacheUseCounter};
+	cacheLookup[block] = victim;
+	return data;
+}
+
+//Keeps cached blocks in sync with data written to the image
+void ATA::IO_CacheUpdate(u64 byteOffset, const u8* data, u64 byteSize)
+{
+	while (byteSize > 0)
+	{
+		const u64 block = byteOffset / cacheBlockSize;
+		const u64 blockPos = byteOffset % cacheBlockSize;
+		const u64 updateSize = std::min<u64>(cacheBlockSize - blockPos, byteSize);
+
+		const auto it = cacheLookup.find(block);
+		if (it != cacheLookup.end())
+			memcpy(&cacheData[static_cast<size_t>(it->second) * cacheBlockSize + blockPos], data, updateSize);
+
+		byteOffset += updateSize;
+		data += updateSize;
+		byteSize -= updateSize;
 	}
 }
 
@@ -92,6 +228,19 @@ bool ATA::IO_Write()
 	}
 
 	const u64 imagePos = entry.sector * 512;
+	if (hddOverlay)
+	{
+		if (!hddOverlay->Write(imagePos, entry.data, entry.length))
+		{
+			Console.Error("DEV9: ATA: Overlay write error");
+			pxAssert(false);
+			abort();
+		}
+		IO_CacheUpdate(imagePos, entry.data, entry.length);
+		delete[] entry.data;
+		return true;
+	}
+
 	if (FileSystem::FSeek64(hddImage, imagePos, SEEK_SET) != 0)
 	{
 		Console.Error("DEV9: ATA: File seek error");
@@ -177,6 +326,7 @@ bool ATA::IO_Write()
 			abort();
 		}
 	}
+	IO_CacheUpdate(imagePos, entry.data, entry.length);
 	delete[] entry.data;
 	return true;
 }
@@ -433,6 +583,8 @@ void ATA::HDD_ReadSync(void (ATA::*drqCMD)())
 	//Set ioWrite false to prevent reading & writing at the same time
 	const bool ioWritePaused = ioWrite;
 	ioWrite = false;
+	//Stop any readahead, we're about to read ourselves
+	ioReadahead = false;
 
 	//wait until thread waiting
 	ioThreadIdle_cv.wait(ioWaitHandle, [&] { return ioThreadIdle_bool; });
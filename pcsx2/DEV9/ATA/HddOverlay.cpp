@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "common/Assertions.h"
+#include "common/Console.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "HddOverlay.h"
+
+namespace
+{
+	struct OverlayHeader
+	{
+		char magic[8];
+		u32 version;
+		u32 blockSize;
+		u64 imageSize;
+	};
+
+	constexpr char overlayMagic[8] = {'P', 'S', '2', 'H', 'D', 'D', 'O', 'V'};
+	constexpr u32 overlayVersion = 1;
+} // namespace
+
+bool HddOverlay::Open(const std::string& overlayPath, std::FILE* parBaseImage, u64 baseImageSize)
+{
+	baseImage = parBaseImage;
+	imageSize = baseImageSize;
+
+	const u64 blockCount = (imageSize + blockSize - 1) / blockSize;
+	blockMap.assign(blockCount, 0);
+	dataOffset = ((headerSize + blockCount * sizeof(u32) + blockSize - 1) / blockSize) * blockSize;
+	usedSlots = 0;
+	blockBuffer = std::make_unique<u8[]>(blockSize);
+
+	if (!FileSystem::FileExists(overlayPath.c_str()))
+		return Create(overlayPath);
+
+	overlayImage = FileSystem::OpenManagedCFile(overlayPath.c_str(), "r+b");
+	if (!overlayImage)
+	{
+		Console.Error("DEV9: ATA: Failed to open HDD overlay '%s'", overlayPath.c_str());
+		return false;
+	}
+
+	OverlayHeader header;
+	if (std::fread(&header, sizeof(header), 1, overlayImage.get()) != 1 ||
+		memcmp(header.magic, overlayMagic, sizeof(overlayMagic)) != 0 ||
+		header.version != overlayVersion || header.blockSize != blockSize)
+	{
+		Console.Error("DEV9: ATA: '%s' is not a valid HDD overlay", overlayPath.c_str());
+		overlayImage.reset();
+		return false;
+	}
+
+	if (header.imageSize != imageSize)
+	{
+		Console.Error("DEV9: ATA: HDD overlay was created for a different base image size");
+		overlayImage.reset();
+		return false;
+	}
+
+	if (FileSystem::FSeek64(overlayImage.get(), headerSize, SEEK_SET) != 0 ||
+		std::fread(blockMap.data(), sizeof(u32), blockCount, overlayImage.get()) != blockCount)
+	{
+		Console.Error("DEV9: ATA: Failed to read HDD overlay block map");
+		overlayImage.reset();
+		return false;
+	}
+
+	for (const u32 slot : blockMap)
+		usedSlots = std::max(usedSlots, slot);
+
+	DevCon.WriteLn("DEV9: ATA: HDD overlay has %u modified blocks", usedSlots);
+	return true;
+}
+
+bool HddOverlay::Create(const std::string& overlayPath)
+{
+	overlayImage = FileSystem::OpenManagedCFile(overlayPath.c_str(), "w+b");
+	if (!overlayImage)
+	{
+		Console.Error("DEV9: ATA: Failed to create HDD overlay '%s'", overlayPath.c_str());
+		return false;
+	}
+
+	OverlayHeader header{};
+	memcpy(header.magic, overlayMagic, sizeof(overlayMagic));
+	header.version = overlayVersion;
+	header.blockSize = blockSize;
+	header.imageSize = imageSize;
+
+	std::unique_ptr<u8[]> headerBlock = std::make_unique<u8[]>(headerSize);
+	memset(headerBlock.get(), 0, headerSize);
+	memcpy(headerBlock.get(), &header, sizeof(header));
+
+	if (std::fwrite(headerBlock.get(), headerSize, 1, overlayImage.get()) != 1 ||
+		std::fwrite(blockMap.data(), sizeof(u32), blockMap.size(), overlayImage.get()) != blockMap.size() ||
+		std::fflush(overlayImage.get()) != 0)
+	{
+		Console.Error("DEV9: ATA: Failed to write HDD overlay header");
+		overlayImage.reset();
+		FileSystem::DeleteFilePath(overlayPath.c_str());
+		return false;
+	}
+
+	Console.WriteLn("DEV9: ATA: Created HDD overlay '%s'", overlayPath.c_str());
+	return true;
+}
+
+void HddOverlay::Close()
+{
+	if (overlayImage)
+		std::fflush(overlayImage.get());
+
+	overlayImage.reset();
+	baseImage = nullptr;
+	blockMap.clear();
+	blockBuffer.reset();
+}
+
+bool HddOverlay::ReadBase(u64 byteOffset, u8* data, u64 byteSize)
+{
+	return FileSystem::FSeek64(baseImage, byteOffset, SEEK_SET) == 0 &&
+		   std::fread(data, byteSize, 1, baseImage) == 1;
+}
+
+bool HddOverlay::Read(u64 byteOffset, u8* data, u64 byteSize)
+{
+	while (byteSize > 0)
+	{
+		const u64 block = byteOffset / blockSize;
+		const u64 blockPos = byteOffset % blockSize;
+		const u64 readSize = std::min<u64>(blockSize - blockPos, byteSize);
+
+		const u32 slot = blockMap[block];
+		if (slot == 0)
+		{
+			if (!ReadBase(byteOffset, data, readSize))
+				return false;
+		}
+		else
+		{
+			const u64 slotPos = dataOffset + static_cast<u64>(slot - 1) * blockSize + blockPos;
+			if (FileSystem::FSeek64(overlayImage.get(), slotPos, SEEK_SET) != 0 ||
+				std::fread(data, readSize, 1, overlayImage.get()) != 1)
+				return false;
+		}
+
+		byteOffset += readSize;
+		data += readSize;
+		byteSize -= readSize;
+	}
+	return true;
+}
+
+// Writes a full block into a new slot, then points the block map at it
+// The map is updated last, so an interrupted write leaves the block reading from the base image
+bool HddOverlay::AllocateBlock(u64 block, const u8* data)
+{
+	const u32 slot = usedSlots + 1;
+	const u64 slotPos = dataOffset + static_cast<u64>(usedSlots) * blockSize;
+	if (FileSystem::FSeek64(overlayImage.get(), slotPos, SEEK_SET) != 0 ||
+		std::fwrite(data, blockSize, 1, overlayImage.get()) != 1)
+		return false;
+
+	if (FileSystem::FSeek64(overlayImage.get(), headerSize + block * sizeof(u32), SEEK_SET) != 0 ||
+		std::fwrite(&slot, sizeof(slot), 1, overlayImage.get()) != 1)
+		return false;
+
+	usedSlots = slot;
+	blockMap[block] = slot;
+	return true;
+}
+
+bool HddOverlay::Write(u64 byteOffset, const u8* data, u64 byteSize)
+{
+	pxAssert(byteOffset + byteSize <= imageSize);
+
+	while (byteSize > 0)
+	{
+		const u64 block = byteOffset / blockSize;
+		const u64 blockPos = byteOffset % blockSize;
+		const u64 writeSize = std::min<u64>(blockSize - blockPos, byteSize);
+
+		const u32 slot = blockMap[block];
+		if (slot != 0)
+		{
+			const u64 slotPos = dataOffset + static_cast<u64>(slot - 1) * blockSize + blockPos;
+			if (FileSystem::FSeek64(overlayImage.get(), slotPos, SEEK_SET) != 0 ||
+				std::fwrite(data, writeSize, 1, overlayImage.get()) != 1)
+				return false;
+		}
+		else if (writeSize == blockSize)
+		{
+			if (!AllocateBlock(block, data))
+				return false;
+		}
+		else
+		{
+			// Partial write to an unmodified block, copy the rest from the base image
+			const u64 blockStart = block * blockSize;
+			const u64 baseSize = std::min<u64>(blockSize, imageSize - blockStart);
+			if (!ReadBase(blockStart, blockBuffer.get(), baseSize))
+				return false;
+			memset(&blockBuffer[baseSize], 0, blockSize - baseSize);
+			memcpy(&blockBuffer[blockPos], data, writeSize);
+
+			if (!AllocateBlock(block, blockBuffer.get()))
+				return false;
+		}
+
+		byteOffset += writeSize;
+		data += writeSize;
+		byteSize -= writeSize;
+	}
+
+	return std::fflush(overlayImage.get()) == 0;
+}
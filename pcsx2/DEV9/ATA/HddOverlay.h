@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/FileSystem.h"
+
+// Copy-on-write overlay on top of a read only base HDD image
+// Lets multiple instances share one base image, with each instance's writes going to its own overlay
+//
+// File layout:
+// [Header/4096] [block map/blockCount*4] [padding to blockSize] [block data...]
+// Block map entries are 0 for blocks still in the base image, otherwise the 1 based slot in the data area
+// Slots are allocated in the order blocks are first written, so the overlay only grows by what was changed
+class HddOverlay
+{
+public:
+	static constexpr u32 blockSize = 64 * 1024;
+
+private:
+	static constexpr u32 headerSize = 4096;
+
+	std::FILE* baseImage = nullptr;
+	FileSystem::ManagedCFilePtr overlayImage;
+	u64 imageSize = 0;
+
+	std::vector<u32> blockMap;
+	u64 dataOffset = 0;
+	u32 usedSlots = 0;
+
+	std::unique_ptr<u8[]> blockBuffer;
+
+public:
+	// baseImage is not owned, and must stay open until Close()
+	bool Open(const std::string& overlayPath, std::FILE* baseImage, u64 baseImageSize);
+	void Close();
+
+	bool Read(u64 byteOffset, u8* data, u64 byteSize);
+	bool Write(u64 byteOffset, const u8* data, u64 byteSize);
+
+private:
+	bool Create(const std::string& overlayPath);
+	bool ReadBase(u64 byteOffset, u8* data, u64 byteSize);
+	bool AllocateBlock(u64 block, const u8* data);
+};
@@ -92,6 +92,16 @@ std::string GetHDDPath()
 	return hddPath;
 }
 
+std::string GetHDDOverlayPath()
+{
+	std::string overlayPath(EmuConfig.DEV9.HddOverlayFile);
+
+	if (!overlayPath.empty() && !Path::IsAbsolute(overlayPath))
+		overlayPath = Path::Combine(EmuFolders::Settings, overlayPath);
+
+	return overlayPath;
+}
+
 s32 DEV9init()
 {
 	DevCon.WriteLn("DEV9: DEV9init");
@@ -185,7 +195,7 @@ s32 DEV9open()
 
 	if (EmuConfig.DEV9.HddEnable)
 	{
-		if (dev9.ata->Open(hddPath) != 0)
+		if (dev9.ata->Open(hddPath, GetHDDOverlayPath()) != 0)
 			EmuConfig.DEV9.HddEnable = false;
 	}
 
@@ -1042,14 +1052,15 @@ void DEV9CheckChanges(const Pcsx2Config& old_config)
 		{
 			//ATA::Open/Close dosn't set any regs
 			//So we can close/open to apply settings
-			if (EmuConfig.DEV9.HddFile != old_config.DEV9.HddFile)
+			if (EmuConfig.DEV9.HddFile != old_config.DEV9.HddFile ||
+				EmuConfig.DEV9.HddOverlayFile != old_config.DEV9.HddOverlayFile)
 			{
 				dev9.ata->Close();
-				if (dev9.ata->Open(hddPath) != 0)
+				if (dev9.ata->Open(hddPath, GetHDDOverlayPath()) != 0)
 					EmuConfig.DEV9.HddEnable = false;
 			}
 		}
-		else if (dev9.ata->Open(hddPath) != 0)
+		else if (dev9.ata->Open(hddPath, GetHDDOverlayPath()) != 0)
 			EmuConfig.DEV9.HddEnable = false;
 	}
 	else if (old_config.DEV9.HddEnable)
@@ -11,15 +11,13 @@
 
 namespace PacketReader
 {
+	//Note: we don't have to worry about the Ethernet Frame CRC as it is not included in the packet
+	//Note: We don't support tagged frames
 	EthernetFrameEditor::EthernetFrameEditor(NetPacket* pkt)
-		: basePkt{pkt}
+		: headerLength{14} //(6+6+2)
+		, basePkt{pkt}
+		, payload{(u8*)&pkt->buffer[14], pkt->size - 14}
 	{
-		headerLength = 14; //(6+6+2)
-
-		//Note: we don't have to worry about the Ethernet Frame CRC as it is not included in the packet
-		//Note: We don't support tagged frames
-
-		payload = std::make_unique<PayloadPtr>((u8*)&basePkt->buffer[14], pkt->size - headerLength);
 	}
 
 	MAC_Address EthernetFrameEditor::GetDestinationMAC()
@@ -47,6 +45,6 @@ namespace PacketReader
 
 	PayloadPtr* EthernetFrameEditor::GetPayload()
 	{
-		return payload.get();
+		return &payload;
 	}
 } // namespace PacketReader
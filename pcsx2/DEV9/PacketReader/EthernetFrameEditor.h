@@ -16,7 +16,7 @@ namespace PacketReader
 		//Length
 	private:
 		NetPacket* basePkt;
-		std::unique_ptr<PayloadPtr> payload;
+		PayloadPtr payload;
 
 	public:
 		EthernetFrameEditor(NetPacket* pkt);
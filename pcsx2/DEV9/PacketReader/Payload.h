@@ -6,6 +6,7 @@
 #include <cstring>
 #include <memory>
 
+#include "common/Assertions.h"
 #include "common/Pcsx2Defs.h"
 
 namespace PacketReader
@@ -50,6 +51,12 @@ namespace PacketReader
 		{
 			return length;
 		}
+		//Used when data was received directly into the buffer, and less arrived than allocated for
+		void Truncate(int len)
+		{
+			pxAssert(len >= 0 && len <= length);
+			length = len;
+		}
 		virtual void WriteBytes(u8* buffer, int* offset)
 		{
 			if (length == 0)
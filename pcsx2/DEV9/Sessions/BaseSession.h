@@ -3,6 +3,10 @@
 
 #pragma once
 
+#ifdef _WIN32
+#include <winsock2.h>
+#endif
+
 #include "DEV9/PacketReader/IP/IP_Packet.h"
 #include <functional>
 #include <optional>
@@ -31,6 +35,17 @@ namespace Sessions
 		std::unique_ptr<PacketReader::IP::IP_Payload> payload;
 	};
 
+	struct RecvPollRequest
+	{
+#ifdef _WIN32
+		SOCKET socket;
+#elif defined(__POSIX__)
+		int socket;
+#endif
+		// Wait for the socket to become writable instead (pending connect)
+		bool write;
+	};
+
 	class BaseSession
 	{
 	public:
@@ -50,6 +65,9 @@ namespace Sessions
 		void AddConnectionClosedHandler(ConnectionClosedEventHandler handler);
 
 		virtual std::optional<ReceivedPayload> Recv() = 0;
+		// Reports the socket Recv() is waiting on, so the adapter can wait on every session at once
+		// Returning false means Recv() has work to do regardless of the socket, and must always be called
+		virtual bool GetRecvPollRequest(RecvPollRequest* request) { return false; }
 		virtual bool Send(PacketReader::IP::IP_Payload* payload) = 0;
 		virtual void Reset() = 0;
 
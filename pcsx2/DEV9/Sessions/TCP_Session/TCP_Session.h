@@ -78,6 +78,7 @@ namespace Sessions
 		TCP_Session(ConnectionKey parKey, PacketReader::IP::IP_Address parAdapterIP);
 
 		virtual std::optional<ReceivedPayload> Recv();
+		virtual bool GetRecvPollRequest(RecvPollRequest* request);
 		virtual bool Send(PacketReader::IP::IP_Payload* payload);
 		virtual void Reset();
 
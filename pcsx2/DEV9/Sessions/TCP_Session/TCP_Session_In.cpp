@@ -20,6 +20,26 @@ using namespace PacketReader::IP::TCP;
 
 namespace Sessions
 {
+	bool TCP_Session::GetRecvPollRequest(RecvPollRequest* request)
+	{
+		// Queued packets from the out thread are returned without touching the socket
+		if (!_recvBuff.IsQueueEmpty())
+			return false;
+
+		switch (state)
+		{
+			case TCP_State::SendingSYN_ACK:
+				*request = {client, true};
+				return true;
+			case TCP_State::Connected:
+			case TCP_State::Closing_ClosedByPS2:
+				*request = {client, false};
+				return true;
+			default:
+				return false;
+		}
+	}
+
 	std::optional<ReceivedPayload> TCP_Session::Recv()
 	{
 		std::unique_ptr<TCP_Packet> ret = PopRecvBuff();
@@ -84,7 +104,7 @@ namespace Sessions
 
 		if (maxSize > 0)
 		{
-			std::unique_ptr<u8[]> buffer;
+			std::unique_ptr<PayloadData> recivedData;
 			int err = 0;
 			int recived;
 
@@ -101,8 +121,8 @@ namespace Sessions
 				if (available > static_cast<uint>(maxSize))
 					Console.WriteLn("DEV9: TCP: Got a lot of data: %lu using: %d", available, maxSize);
 
-				buffer = std::make_unique<u8[]>(maxSize);
-				recived = recv(client, reinterpret_cast<char*>(buffer.get()), maxSize, 0);
+				recivedData = std::make_unique<PayloadData>(maxSize);
+				recived = recv(client, reinterpret_cast<char*>(recivedData->data.get()), maxSize, 0);
 				if (recived == -1)
 #ifdef _WIN32
 					err = WSAGetLastError();
@@ -165,10 +185,10 @@ namespace Sessions
 				}
 				DevCon.WriteLn("DEV9: TCP: [SRV] Sending %d bytes", recived);
 
-				PayloadData* recivedData = new PayloadData(recived);
-				memcpy(recivedData->data.get(), buffer.get(), recived);
+				// Received in place, trim to what actually arrived
+				recivedData->Truncate(recived);
 
-				std::unique_ptr<TCP_Packet> iRet = CreateBasePacket(recivedData);
+				std::unique_ptr<TCP_Packet> iRet = CreateBasePacket(recivedData.release());
 				IncrementMyNumber((u32)recived);
 
 				iRet->SetACK(true);
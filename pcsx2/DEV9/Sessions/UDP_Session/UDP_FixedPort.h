@@ -41,6 +41,7 @@ namespace Sessions
 		void Init();
 
 		virtual std::optional<ReceivedPayload> Recv();
+		virtual bool GetRecvPollRequest(RecvPollRequest* request);
 		virtual bool Send(PacketReader::IP::IP_Payload* payload);
 		virtual void Reset();
 
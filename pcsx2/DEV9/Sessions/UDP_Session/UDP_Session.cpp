@@ -59,6 +59,16 @@ namespace Sessions
 	{
 	}
 
+	bool UDP_Session::GetRecvPollRequest(RecvPollRequest* request)
+	{
+		// Fixed port sessions are fed by their UDP_FixedPort, Recv() only checks the idle timeout
+		if (!open.load() || isFixedPort)
+			return false;
+
+		*request = {client, false};
+		return true;
+	}
+
 	std::optional<ReceivedPayload> UDP_Session::Recv()
 	{
 		if (!open.load())
@@ -120,8 +130,7 @@ namespace Sessions
 		if (hasData)
 		{
 			unsigned long available = 0;
-			PayloadData* recived = nullptr;
-			std::unique_ptr<u8[]> buffer;
+			std::unique_ptr<PayloadData> recived;
 			sockaddr_in endpoint{};
 
 			// FIONREAD returns total size of all available messages
@@ -133,14 +142,14 @@ namespace Sessions
 #endif
 			if (ret != SOCKET_ERROR)
 			{
-				buffer = std::make_unique<u8[]>(available);
+				recived = std::make_unique<PayloadData>(available);
 
 #ifdef _WIN32
 				int fromlen = sizeof(endpoint);
 #elif defined(__POSIX__)
 				socklen_t fromlen = sizeof(endpoint);
 #endif
-				ret = recvfrom(client, reinterpret_cast<char*>(buffer.get()), available, 0, reinterpret_cast<sockaddr*>(&endpoint), &fromlen);
+				ret = recvfrom(client, reinterpret_cast<char*>(recived->data.get()), available, 0, reinterpret_cast<sockaddr*>(&endpoint), &fromlen);
 			}
 
 			if (ret == SOCKET_ERROR)
@@ -155,10 +164,10 @@ namespace Sessions
 				return std::nullopt;
 			}
 
-			recived = new PayloadData(ret);
-			memcpy(recived->data.get(), buffer.get(), ret);
+			// Received in place, FIONREAD may have reported more than this message
+			recived->Truncate(ret);
 
-			std::unique_ptr<UDP_Packet> iRet = std::make_unique<UDP_Packet>(recived);
+			std::unique_ptr<UDP_Packet> iRet = std::make_unique<UDP_Packet>(recived.release());
 			iRet->destinationPort = srcPort;
 			iRet->sourcePort = destPort;
 
@@ -47,6 +47,7 @@ namespace Sessions
 #endif
 
 		virtual std::optional<ReceivedPayload> Recv();
+		virtual bool GetRecvPollRequest(RecvPollRequest* request);
 		virtual bool WillRecive(PacketReader::IP::IP_Address parDestIP);
 		virtual bool Send(PacketReader::IP::IP_Payload* payload);
 		virtual void Reset();
@@ -66,6 +66,20 @@ public:
 		return keys;
 	}
 
+	//Holds the read lock while calling func, which must not modify the map
+	template <typename F>
+	void ForEach(F func)
+	{
+#ifdef NO_SHARED_MUTEX
+		std::unique_lock readLock(accessMutex);
+#else
+		std::shared_lock readLock(accessMutex);
+#endif
+
+		for (auto iter = map.begin(); iter != map.end(); ++iter)
+			func(iter->first, iter->second);
+	}
+
 	//Does not error or insert if no key is found
 	bool TryGetValue(Key key, T* value)
 	{
@@ -12,6 +12,8 @@
 #include <sys/types.h>
 #include <ifaddrs.h>
 
+#include <errno.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <net/if.h>
@@ -27,6 +29,8 @@
 #include "Sessions/UDP_Session/UDP_Session.h"
 
 #include "PacketReader/EthernetFrame.h"
+#include "PacketReader/EthernetFrameEditor.h"
+#include "PacketReader/NetLib.h"
 #include "PacketReader/ARP/ARP_Packet.h"
 #include "PacketReader/IP/ICMP/ICMP_Packet.h"
 #include "PacketReader/IP/TCP/TCP_Packet.h"
@@ -40,6 +44,11 @@ using namespace PacketReader::IP::ICMP;
 using namespace PacketReader::IP::TCP;
 using namespace PacketReader::IP::UDP;
 
+//Sessions are also serviced regardless of their socket at this interval, so idle timeouts still fire
+static constexpr std::chrono::milliseconds FULL_POLL_INTERVAL{100};
+//Frames buffered from a single poll of the sessions
+static constexpr size_t MAX_RECV_FRAMES = 32;
+
 std::vector<AdapterEntry> SocketAdapter::GetAdapters()
 {
 	std::vector<AdapterEntry> nic;
@@ -183,6 +192,8 @@ SocketAdapter::SocketAdapter()
 
 	sendThreadId = std::this_thread::get_id();
 
+	recvFrames.resize(MAX_RECV_FRAMES);
+
 	initialized = true;
 }
 
@@ -209,45 +220,115 @@ bool SocketAdapter::recv(NetPacket* pkt)
 	});
 
 	EthernetFrame* bFrame;
-	if (!vRecBuffer.Dequeue(&bFrame))
+	if (vRecBuffer.Dequeue(&bFrame))
 	{
-		std::vector<ConnectionKey> keys = connections.GetKeys();
-		for (size_t i = 0; i < keys.size(); i++)
-		{
-			const ConnectionKey key = keys[i];
+		bFrame->WritePacket(pkt);
+		InspectRecv(pkt);
 
-			BaseSession* session;
-			if (!connections.TryGetValue(key, &session))
-				continue;
+		delete bFrame;
+		return true;
+	}
 
-			std::optional<ReceivedPayload> pl = session->Recv();
+	if (recvFramesRead == recvFramesCount)
+	{
+		recvFramesRead = 0;
+		recvFramesCount = 0;
+		PollSessions();
+		if (recvFramesCount == 0)
+			return false;
+	}
 
-			if (pl.has_value())
-			{
-				IP_Packet* ipPkt = new IP_Packet(pl->payload.release());
-				ipPkt->destinationIP = session->sourceIP;
-				ipPkt->sourceIP = pl->sourceIP;
-
-				EthernetFrame frame(ipPkt);
-				frame.sourceMAC = internalMAC;
-				frame.destinationMAC = ps2MAC;
-				frame.protocol = static_cast<u16>(EtherType::IPv4);
-
-				frame.WritePacket(pkt);
-				InspectRecv(pkt);
-				return true;
-			}
+	const NetPacket& frame = recvFrames[recvFramesRead++];
+	pkt->size = frame.size;
+	memcpy(pkt->buffer, frame.buffer, frame.size);
+	InspectRecv(pkt);
+	return true;
+}
+
+void SocketAdapter::PollSessions()
+{
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	const bool fullPoll = now >= nextFullPoll;
+	if (fullPoll)
+		nextFullPoll = now + FULL_POLL_INTERVAL;
+
+	polledSessions.clear();
+	pollFds.clear();
+
+	connections.ForEach([&](const ConnectionKey& key, BaseSession* session) {
+		RecvPollRequest request;
+		int pollIndex = -1;
+		if (!fullPoll && session->GetRecvPollRequest(&request))
+		{
+			pollIndex = static_cast<int>(pollFds.size());
+			pollFds.push_back({request.socket, static_cast<short>(request.write ? POLLOUT : POLLIN), 0});
+		}
+		polledSessions.push_back({key, session, pollIndex});
+	});
+
+	if (!pollFds.empty())
+	{
+		//Single syscall for every waiting session, instead of a select/recv per session
+#ifdef _WIN32
+		const int ret = WSAPoll(pollFds.data(), static_cast<ULONG>(pollFds.size()), 0);
+#elif defined(__POSIX__)
+		const int ret = poll(pollFds.data(), static_cast<nfds_t>(pollFds.size()), 0);
+#endif
+		if (ret < 0)
+		{
+			Console.Error("DEV9: Socket: Poll failed. Error code: %d",
+#ifdef _WIN32
+				WSAGetLastError());
+#elif defined(__POSIX__)
+				errno);
+#endif
+			//Let each session check its own socket
+			for (pollfd& pfd : pollFds)
+				pfd.revents = pfd.events;
 		}
 	}
-	else
+
+	for (const PolledSession& entry : polledSessions)
 	{
-		bFrame->WritePacket(pkt);
-		InspectRecv(pkt);
+		//Sessions left over are still ready on the next poll
+		if (recvFramesCount == recvFrames.size())
+			break;
 
-		delete bFrame;
-		return true;
+		if (entry.pollIndex >= 0 && pollFds[entry.pollIndex].revents == 0)
+			continue;
+
+		//The session may have been closed since ForEach()
+		BaseSession* session;
+		if (!connections.TryGetValue(entry.key, &session) || session != entry.session)
+			continue;
+
+		std::optional<ReceivedPayload> pl = session->Recv();
+		if (!pl.has_value())
+			continue;
+
+		IP_Packet ipPkt(pl->payload.release());
+		ipPkt.destinationIP = session->sourceIP;
+		ipPkt.sourceIP = pl->sourceIP;
+
+		//Serialise straight into the frame buffer
+		NetPacket& frame = recvFrames[recvFramesCount];
+		const int frameSize = 14 + ipPkt.GetLength();
+		if (frameSize > static_cast<int>(sizeof(frame.buffer)))
+		{
+			Console.Error("DEV9: Socket: Dropping oversized packet of %d bytes", frameSize);
+			continue;
+		}
+
+		int offset = 0;
+		u8* buffer = reinterpret_cast<u8*>(frame.buffer);
+		NetLib::WriteMACAddress(buffer, &offset, ps2MAC);
+		NetLib::WriteMACAddress(buffer, &offset, internalMAC);
+		NetLib::WriteUInt16(buffer, &offset, static_cast<u16>(EtherType::IPv4));
+		ipPkt.WriteBytes(buffer, &offset);
+		frame.size = offset;
+
+		recvFramesCount++;
 	}
-	return false;
 }
 
 bool SocketAdapter::send(NetPacket* pkt)
@@ -264,9 +345,10 @@ bool SocketAdapter::send(NetPacket* pkt)
 		deleteQueueSendThread.clear();
 	});
 
-	EthernetFrame frame(pkt);
+	//Parsed in place, nothing here needs to outlive pkt
+	EthernetFrameEditor frame(pkt);
 
-	switch (frame.protocol)
+	switch (frame.GetProtocol())
 	{
 		case (u16)EtherType::null:
 		case 0x0C00:
@@ -275,14 +357,14 @@ bool SocketAdapter::send(NetPacket* pkt)
 			return true;
 		case (int)EtherType::IPv4:
 		{
-			PayloadPtr* payload = static_cast<PayloadPtr*>(frame.GetPayload());
+			PayloadPtr* payload = frame.GetPayload();
 			IP_Packet ippkt(payload->data, payload->GetLength());
 
 			return SendIP(&ippkt);
 		}
 		case (u16)EtherType::ARP:
 		{
-			PayloadPtr* payload = static_cast<PayloadPtr*>(frame.GetPayload());
+			PayloadPtr* payload = frame.GetPayload();
 			ARP_Packet arpPkt(payload->data, payload->GetLength());
 
 			if (arpPkt.protocol == (u16)EtherType::IPv4)
@@ -313,7 +395,7 @@ bool SocketAdapter::send(NetPacket* pkt)
 			return true;
 		}
 		default:
-			Console.Error("DEV9: Socket: Unkown EtherframeType %X", frame.protocol);
+			Console.Error("DEV9: Socket: Unkown EtherframeType %X", frame.GetProtocol());
 			return false;
 	}
 
@@ -2,8 +2,15 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #pragma once
+#include <chrono>
 #include <vector>
 
+#ifdef _WIN32
+#include <winsock2.h>
+#elif defined(__POSIX__)
+#include <poll.h>
+#endif
+
 #include "net.h"
 
 #include "PacketReader/IP/IP_Packet.h"
@@ -32,6 +39,24 @@ class SocketAdapter : public NetAdapter
 	std::vector<Sessions::BaseSession*> deleteQueueSendThread;
 	std::vector<Sessions::BaseSession*> deleteQueueRecvThread;
 
+	struct PolledSession
+	{
+		Sessions::ConnectionKey key;
+		Sessions::BaseSession* session;
+		//Index into pollFds, or -1 if Recv() is always called
+		int pollIndex;
+	};
+
+	//Only used by the recv thread, kept to avoid reallocating every poll
+	std::vector<PolledSession> polledSessions;
+	std::vector<pollfd> pollFds;
+	std::chrono::steady_clock::time_point nextFullPoll;
+
+	//Frames written by PollSessions(), reused so receiving doesn't allocate per packet
+	std::vector<NetPacket> recvFrames;
+	size_t recvFramesRead = 0;
+	size_t recvFramesCount = 0;
+
 public:
 	SocketAdapter();
 	virtual bool blocks();
@@ -56,6 +81,9 @@ private:
 
 	int SendFromConnection(Sessions::ConnectionKey Key, PacketReader::IP::IP_Packet* ipPkt);
 
+	//Receives from sessions with data available, writing the frames into recvFrames
+	void PollSessions();
+
 	//Event must only be raised once per connection
 	void HandleConnectionClosed(Sessions::BaseSession* sender);
 	void HandleFixedPortClosed(Sessions::BaseSession* sender);
@@ -11,6 +11,7 @@
 #include "GS/GSGL.h"
 #include "GS/GSLzma.h"
 #include "GS/GSPerfMon.h"
+#include "GS/GSThreadPool.h"
 #include "GS/GSUtil.h"
 #include "GS/MultiISA.h"
 #include "Host.h"
@@ -366,6 +367,7 @@ void GSclose()
 
 	CloseGSRenderer();
 	CloseGSDevice(true);
+	GSThreadPool::Shutdown();
 	Host::ReleaseRenderWindow();
 }
 
@@ -106,6 +106,26 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	return (++m_frames & 1) == 0 && last && (m_extra_frames < 0);
 }
 
+bool GSDumpBase::NeedsKeyframe(u32 interval) const
+{
+	return m_gs && interval > 0 && m_frames > 0 && (static_cast<u32>(m_frames) % interval) == 0;
+}
+
+void GSDumpBase::Keyframe(u32 interval, const freezeData& fd, const GSPrivRegSet* regs)
+{
+	if (!m_gs)
+		return;
+
+	const GSDumpKeyframeHeader header = {static_cast<u32>(m_frames), interval};
+	const u32 size = static_cast<u32>(sizeof(header) + fd.size + sizeof(*regs));
+
+	AppendRawData(4);
+	AppendRawData(&size, 4);
+	AppendRawData(&header, sizeof(header));
+	AppendRawData(fd.data, fd.size);
+	AppendRawData(regs, sizeof(*regs));
+}
+
 void GSDumpBase::Write(const void* data, size_t size)
 {
 	if (!m_gs || size == 0)
@@ -24,6 +24,9 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+State data (id == 4), written after a VSync every GSDumpKeyframeInterval frames when enabled
+- [4/1] [size/4] [GSDumpKeyframeHeader] [state data] [PMODE/0x2000]
+
 */
 
 #pragma pack(push, 4)
@@ -39,6 +42,13 @@ struct GSDumpHeader
 	u32 screenshot_offset;
 	u32 screenshot_size;
 };
+
+/// Precedes the GS state in keyframe packets. Frame is the number of VSync packets before the keyframe.
+struct GSDumpKeyframeHeader
+{
+	u32 frame;
+	u32 interval;
+};
 #pragma pack(pop)
 
 class GSDumpBase
@@ -67,6 +77,10 @@ public:
 	void Transfer(int index, const u8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
 
+	/// Returns true if a keyframe is due after the VSync that was just written.
+	bool NeedsKeyframe(u32 interval) const;
+	void Keyframe(u32 interval, const freezeData& fd, const GSPrivRegSet* regs);
+
 	static std::unique_ptr<GSDumpBase> CreateUncompressedDump(
 		const std::string& fn, const std::string& serial, u32 crc,
 		u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
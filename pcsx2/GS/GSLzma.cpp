@@ -8,6 +8,7 @@
 #include "common/BitUtils.h"
 #include "common/Error.h"
 #include "common/HeapArray.h"
+#include "common/Threading.h"
 
 #include "GS/GSDump.h"
 #include "GS/GSLzma.h"
@@ -84,6 +85,8 @@ bool GSDumpFile::ReadFile(Error* error)
 		return false;
 	}
 
+	m_packets_offset = sizeof(m_crc) + sizeof(ss) + ss;
+
 	// Pull serial out of new header, if present.
 	if (m_crc == 0xFFFFFFFFu)
 	{
@@ -117,6 +120,8 @@ bool GSDumpFile::ReadFile(Error* error)
 			Error::SetString(error, "Failed to read real state data");
 			return false;
 		}
+
+		m_packets_offset += header.state_size;
 	}
 
 	m_regs_data.resize(8192);
@@ -126,69 +131,175 @@ bool GSDumpFile::ReadFile(Error* error)
 		return false;
 	}
 
-	// read all the packet data in
-	// TODO: make this suck less by getting the full/extracted size and preallocating
-	for (;;)
+	m_packets_offset += m_regs_data.size();
+
+	StartPacketReader();
+	return true;
+}
+
+const GSDumpFile::GSData* GSDumpFile::GetNextPacket()
+{
+	if (m_current_chunk && m_current_chunk_pos < m_current_chunk->packets.size()) [[likely]]
+	{
+		m_packets_read++;
+		return &m_current_chunk->packets[m_current_chunk_pos++];
+	}
+
+	std::unique_lock lock(m_reader_mutex);
+	if (m_current_chunk)
+		m_free_chunks.push_back(std::move(m_current_chunk));
+
+	m_consumer_cv.wait(lock, [this]() { return !m_ready_chunks.empty() || m_reader_done; });
+	if (m_ready_chunks.empty())
+	{
+		// end of the stream, now we know how many packets there are
+		m_packet_count = m_packets_read;
+		return nullptr;
+	}
+
+	m_current_chunk = std::move(m_ready_chunks.front());
+	m_ready_chunks.pop_front();
+	m_current_chunk_pos = 0;
+	m_reader_cv.notify_one();
+	lock.unlock();
+
+	m_packets_read++;
+	return &m_current_chunk->packets[m_current_chunk_pos++];
+}
+
+void GSDumpFile::RestartPackets()
+{
+	// nothing consumed yet, the window already starts at the first packet
+	if (m_packets_read == 0)
+		return;
+
+	StopPacketReader();
+
+	m_current_chunk.reset();
+	m_current_chunk_pos = 0;
+	m_packets_read = 0;
+	for (std::unique_ptr<PacketChunk>& chunk : m_ready_chunks)
+		m_free_chunks.push_back(std::move(chunk));
+	m_ready_chunks.clear();
+
+	// skip back over the header, it's small compared to the packets
+	if (!Rewind())
 	{
-		const size_t packet_data_size = m_packet_data.size();
-		m_packet_data.resize(std::max<size_t>(packet_data_size * 2, 8 * _1mb));
+		Console.Error("(GSDump) Failed to rewind dump.");
+		m_reader_done = true;
+		return;
+	}
 
-		const size_t read_size = m_packet_data.size() - packet_data_size;
-		const size_t read = Read(m_packet_data.data() + packet_data_size, read_size);
-		if (read != read_size)
+	std::unique_ptr<u8[]> skip_buffer = std::make_unique_for_overwrite<u8[]>(64 * _1kb);
+	for (size_t remaining = m_packets_offset; remaining > 0;)
+	{
+		const size_t size = std::min<size_t>(remaining, 64 * _1kb);
+		if (Read(skip_buffer.get(), size) != size)
 		{
-			if (!IsEof())
-			{
-				Error::SetString(error, "Failed to read packet");
-				return false;
-			}
+			Console.Error("(GSDump) Failed to skip dump header.");
+			m_reader_done = true;
+			return;
+		}
+
+		remaining -= size;
+	}
+
+	StartPacketReader();
+}
+
+void GSDumpFile::StartPacketReader()
+{
+	pxAssert(!m_reader_thread.joinable());
+	m_reader_stop = false;
+	m_reader_done = false;
+	m_reader_thread = std::thread(&GSDumpFile::PacketReaderThreadEntryPoint, this);
+}
+
+void GSDumpFile::StopPacketReader()
+{
+	if (!m_reader_thread.joinable())
+		return;
 
-			m_packet_data.resize(packet_data_size + read);
-			m_packet_data.shrink_to_fit();
+	{
+		std::unique_lock lock(m_reader_mutex);
+		m_reader_stop = true;
+		m_reader_cv.notify_one();
+	}
+
+	m_reader_thread.join();
+}
+
+void GSDumpFile::PacketReaderThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("GS Dump Reader");
+
+	std::unique_lock lock(m_reader_mutex);
+	for (;;)
+	{
+		m_reader_cv.wait(lock, [this]() { return m_reader_stop || m_ready_chunks.size() < MAX_READY_PACKET_CHUNKS; });
+		if (m_reader_stop)
 			break;
+
+		std::unique_ptr<PacketChunk> chunk;
+		if (!m_free_chunks.empty())
+		{
+			chunk = std::move(m_free_chunks.back());
+			m_free_chunks.pop_back();
+		}
+		else
+		{
+			chunk = std::make_unique<PacketChunk>();
+			chunk->data.reserve(PACKET_CHUNK_SIZE);
 		}
+
+		lock.unlock();
+		const bool more = ReadPacketChunk(*chunk);
+		lock.lock();
+
+		if (!chunk->packets.empty())
+			m_ready_chunks.push_back(std::move(chunk));
+		else
+			m_free_chunks.push_back(std::move(chunk));
+
+		if (!more)
+			m_reader_done = true;
+
+		m_consumer_cv.notify_one();
+		if (!more)
+			break;
 	}
+}
 
-	u8* data = m_packet_data.data();
-	size_t remaining = m_packet_data.size();
-
-#define GET_BYTE(dst) \
-	do \
-	{ \
-		if (remaining < sizeof(u8)) \
-		{ \
-			Error::SetString(error, "Failed to read byte"); \
-			return false; \
-		} \
-		std::memcpy(dst, data, sizeof(u8)); \
-		data++; \
-		remaining--; \
-	} while (0)
-#define GET_WORD(dst) \
-	do \
-	{ \
-		if (remaining < sizeof(u32)) \
-		{ \
-			Error::SetString(error, "Failed to read word"); \
-			return false; \
-		} \
-		std::memcpy(dst, data, sizeof(u32)); \
-		data += sizeof(u32); \
-		remaining -= sizeof(u32); \
-	} while (0)
-
-	while (remaining > 0)
+bool GSDumpFile::ReadPacketChunk(PacketChunk& chunk)
+{
+	chunk.data.clear();
+	chunk.packets.clear();
+
+	bool more = true;
+	while (chunk.data.size() < PACKET_CHUNK_SIZE)
 	{
 		GSData packet = {};
 		packet.path = GSTransferPath::Dummy;
-		GET_BYTE(&packet.id);
+		if (Read(&packet.id, sizeof(packet.id)) != sizeof(packet.id))
+		{
+			if (!IsEof())
+				Console.Error("(GSDump) Failed to read packet.");
+
+			more = false;
+			break;
+		}
 
+		bool header_ok = true;
 		switch (packet.id)
 		{
 			case GSType::Transfer:
-				GET_BYTE(&packet.path);
-				GET_WORD(&packet.length);
-				break;
+			{
+				u32 length;
+				header_ok = (Read(&packet.path, sizeof(packet.path)) == sizeof(packet.path) &&
+							 Read(&length, sizeof(length)) == sizeof(length));
+				packet.length = length;
+			}
+			break;
 			case GSType::VSync:
 				packet.length = 1;
 				break;
@@ -198,35 +309,56 @@ bool GSDumpFile::ReadFile(Error* error)
 			case GSType::Registers:
 				packet.length = 8192;
 				break;
+			case GSType::State:
+			{
+				u32 length;
+				header_ok = (Read(&length, sizeof(length)) == sizeof(length));
+				packet.length = length;
+			}
+			break;
 			default:
-				Error::SetString(error, fmt::format("Unknown packet type {}", static_cast<u32>(packet.id)));
-				return false;
+				Console.Error(fmt::format("(GSDump) Unknown packet type {}", static_cast<u32>(packet.id)));
+				header_ok = false;
+				break;
+		}
+
+		if (!header_ok)
+		{
+			more = false;
+			break;
 		}
 
 		if (packet.length > 0)
 		{
-			if (remaining < packet.length)
+			const size_t offset = chunk.data.size();
+			chunk.data.resize(offset + packet.length);
+
+			const size_t read = Read(chunk.data.data() + offset, packet.length);
+			if (read != packet.length)
 			{
 				// There's apparently some "bad" dumps out there that are missing bytes on the end..
 				// The "safest" option here is to discard the last packet, since that has less risk
 				// of leaving the GS in the middle of a command.
 				Console.Error("(GSDump) Dropping last packet of %u bytes (we only have %u bytes)",
-					static_cast<u32>(packet.length), static_cast<u32>(remaining));
+					static_cast<u32>(packet.length), static_cast<u32>(read));
+				chunk.data.resize(offset);
+				more = false;
 				break;
 			}
-
-			packet.data = data;
-			data += packet.length;
-			remaining -= packet.length;
 		}
 
-		m_dump_packets.push_back(std::move(packet));
+		chunk.packets.push_back(std::move(packet));
 	}
 
-#undef GET_WORD
-#undef GET_BYTE
+	// data can move while the chunk is filled, so only point packets at it once it's complete
+	const u8* data = chunk.data.data();
+	for (GSData& packet : chunk.packets)
+	{
+		packet.data = data;
+		data += packet.length;
+	}
 
-	return true;
+	return more;
 }
 
 /******************************************************************/
@@ -253,6 +385,7 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Rewind() override;
 
 	private:
 		static constexpr size_t kInputBufSize = static_cast<size_t>(1) << 18;
@@ -285,6 +418,7 @@ namespace
 
 	GSDumpLzma::~GSDumpLzma()
 	{
+		StopPacketReader();
 		XzUnpacker_Free(&m_unpacker);
 	}
 
@@ -437,6 +571,14 @@ namespace
 		return true;
 	}
 
+	bool GSDumpLzma::Rewind()
+	{
+		m_block_index = 0;
+		m_block_size = 0;
+		m_block_pos = 0;
+		return true;
+	}
+
 	bool GSDumpLzma::IsEof()
 	{
 		return (m_block_pos == m_block_size && m_block_index == m_blocks.size());
@@ -487,12 +629,15 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Rewind() override;
 	};
 
 	GSDumpDecompressZst::GSDumpDecompressZst() = default;
 
 	GSDumpDecompressZst::~GSDumpDecompressZst()
 	{
+		StopPacketReader();
+
 		if (m_strm)
 			ZSTD_freeDStream(m_strm);
 
@@ -547,6 +692,19 @@ namespace
 		return true;
 	}
 
+	bool GSDumpDecompressZst::Rewind()
+	{
+		if (FileSystem::FSeek64(m_fp.get(), 0, SEEK_SET) != 0)
+			return false;
+
+		ZSTD_initDStream(m_strm);
+		m_inbuf.pos = 0;
+		m_inbuf.size = 0;
+		m_avail = 0;
+		m_start = 0;
+		return true;
+	}
+
 	bool GSDumpDecompressZst::IsEof()
 	{
 		return feof(m_fp.get()) && m_avail == 0 && m_inbuf.pos == m_inbuf.size;
@@ -586,11 +744,15 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Rewind() override;
 	};
 
 	GSDumpRaw::GSDumpRaw() = default;
 
-	GSDumpRaw::~GSDumpRaw() = default;
+	GSDumpRaw::~GSDumpRaw()
+	{
+		StopPacketReader();
+	}
 
 	bool GSDumpRaw::Open(FileSystem::ManagedCFilePtr fp, Error* error)
 	{
@@ -598,6 +760,11 @@ namespace
 		return true;
 	}
 
+	bool GSDumpRaw::Rewind()
+	{
+		return (FileSystem::FSeek64(m_fp.get(), 0, SEEK_SET) == 0);
+	}
+
 	bool GSDumpRaw::IsEof()
 	{
 		return !!feof(m_fp.get());
@@ -5,8 +5,12 @@
 
 #include "common/FileSystem.h"
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 class Error;
@@ -38,7 +42,8 @@ namespace GSDumpTypes
 	X(GSType, Transfer,  0) \
 	X(GSType, VSync,     1) \
 	X(GSType, ReadFIFO2, 2) \
-	X(GSType, Registers, 3)
+	X(GSType, Registers, 3) \
+	X(GSType, State,     4)
 		GEN_REG_ENUM_CLASS_AND_GETNAME(DEF_GSType, GSType, u8, "UnknownType")
 #undef DEF_GSType
 
@@ -300,10 +305,20 @@ public:
 
 	__fi const ByteArray& GetRegsData() const { return m_regs_data; }
 	__fi const ByteArray& GetStateData() const { return m_state_data; }
-	__fi const GSDataArray& GetPackets() const { return m_dump_packets; }
 
+	/// Number of packets in the dump. Only known once the stream has been read to the end, zero before that.
+	__fi size_t GetPacketCount() const { return m_packet_count; }
+
+	/// Reads the header, state and registers, then starts decompressing packets in the background.
 	bool ReadFile(Error* error);
 
+	/// Returns the next packet, or nullptr at the end of the dump. The packet (and its data) is
+	/// only valid until the next call.
+	const GSData* GetNextPacket();
+
+	/// Rewinds the packet stream back to the first packet.
+	void RestartPackets();
+
 protected:
 	GSDumpFile();
 
@@ -311,18 +326,53 @@ protected:
 	virtual bool IsEof() = 0;
 	virtual size_t Read(void* ptr, size_t size) = 0;
 
+	/// Returns to the beginning of the uncompressed stream.
+	virtual bool Rewind() = 0;
+
+	/// Must be called by the derived class destructor, since the reader thread calls Read().
+	void StopPacketReader();
+
 protected:
 	FileSystem::ManagedCFilePtr m_fp;
 
 private:
+	// Packets are decompressed into chunks of roughly this size, with at most MAX_READY_PACKET_CHUNKS
+	// queued ahead of the replayer. Memory use is bounded by the window, not the dump size.
+	static constexpr size_t PACKET_CHUNK_SIZE = 4 * 1024 * 1024;
+	static constexpr size_t MAX_READY_PACKET_CHUNKS = 4;
+
+	struct PacketChunk
+	{
+		ByteArray data;
+		GSDataArray packets;
+	};
+
+	void StartPacketReader();
+	void PacketReaderThreadEntryPoint();
+	bool ReadPacketChunk(PacketChunk& chunk);
+
 	std::string m_serial;
 	u32 m_crc = 0;
 
 	std::vector<u8> m_regs_data;
 	std::vector<u8> m_state_data;
-	std::vector<u8> m_packet_data;
 
-	GSDataArray m_dump_packets;
+	// Offset of the first packet in the uncompressed stream, for rewinding.
+	size_t m_packets_offset = 0;
+	size_t m_packet_count = 0;
+	size_t m_packets_read = 0;
+
+	std::unique_ptr<PacketChunk> m_current_chunk;
+	size_t m_current_chunk_pos = 0;
+
+	std::thread m_reader_thread;
+	std::mutex m_reader_mutex;
+	std::condition_variable m_reader_cv;
+	std::condition_variable m_consumer_cv;
+	std::deque<std::unique_ptr<PacketChunk>> m_ready_chunks;
+	std::vector<std::unique_ptr<PacketChunk>> m_free_chunks;
+	bool m_reader_stop = false;
+	bool m_reader_done = false;
 };
 
 // Initializes CRC tables used by LZMA SDK.
@@ -5,6 +5,7 @@
 #include "GS/GSDump.h"
 #include "GS/GSGL.h"
 #include "GS/GSPerfMon.h"
+#include "GS/GSThreadPool.h"
 #include "GS/GSUtil.h"
 
 #include "common/Console.h"
@@ -115,6 +116,8 @@ GSState::GSState()
 
 GSState::~GSState()
 {
+	WaitForPendingWrites();
+
 	if (m_vertex.buff)
 		_aligned_free(m_vertex.buff);
 	if (m_index.buff)
@@ -882,7 +885,12 @@ void GSState::ApplyTEX0(GIFRegTEX0& TEX0)
 
 			// Invalidating videomem is slow, so *only* do it when it's definitely a CLUT draw in HW mode.
 			for (int j = 0; j < blocks; j++, BITBLTBUF.SBP++)
+			{
+				if (m_async_write_pending_size > 0)
+					WaitForPendingWrites(m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM), r);
+
 				InvalidateLocalMem(BITBLTBUF, r, true);
+			}
 		}
 		else
 		{
@@ -895,6 +903,9 @@ void GSState::ApplyTEX0(GIFRegTEX0& TEX0)
 			r.right = r.left + GSLocalMemory::m_psm[TEX0.CPSM].pal;
 			r.bottom = r.top + 1;
 
+			if (m_async_write_pending_size > 0)
+				WaitForPendingWrites(m_mem.GetOffset(BITBLTBUF.SBP, BITBLTBUF.SBW, BITBLTBUF.SPSM), r);
+
 			InvalidateLocalMem(BITBLTBUF, r, true);
 		}
 
@@ -1440,13 +1451,16 @@ void GSState::GIFRegHandlerTRXDIR(const GIFReg* RESTRICT r)
 	switch (m_env.TRXDIR.XDIR)
 	{
 		case 0: // host -> local
+			m_async_write_tr_pending = false;
 			m_tr.Init(m_env.TRXPOS.DSAX, m_env.TRXPOS.DSAY, m_env.BITBLTBUF, true);
 			break;
 		case 1: // local -> host
+			m_async_write_tr_pending = false;
 			m_tr.Init(m_env.TRXPOS.SSAX, m_env.TRXPOS.SSAY, m_env.BITBLTBUF, false);
 			break;
 		case 2: // local -> local
 			CheckWriteOverlap(true, true);
+			WaitForPendingWrites();
 			Move();
 			break;
 		default: // 3 deactivated as stated by manual. Tested on hardware and no transfers happen.
@@ -1470,6 +1484,10 @@ void GSState::Flush(GSFlushReason reason)
 {
 	FlushWrite();
 
+	// These can look at any part of local memory, so every queued swizzle has to land first.
+	if (reason & (GSFlushReason::RESET | GSFlushReason::SAVESTATE | GSFlushReason::LOADSTATE | GSFlushReason::VSYNC | GSFlushReason::GSREOPEN))
+		WaitForPendingWrites();
+
 	if (m_index.tail > 0)
 	{
 		m_state_flush_reason = reason;
@@ -1522,6 +1540,10 @@ void GSState::FlushWrite()
 
 	InvalidateVideoMem(m_env.BITBLTBUF, r);
 
+	// Writes to the same pages have to be applied in order.
+	if (m_async_write_pending_size > 0)
+		WaitForPendingWrites(m_mem.GetOffset(m_env.BITBLTBUF.DBP, m_env.BITBLTBUF.DBW, m_env.BITBLTBUF.DPSM), r);
+
 	const GSLocalMemory::writeImage wi = GSLocalMemory::m_psm[m_env.BITBLTBUF.DPSM].wi;
 
 	wi(m_mem, m_tr.x, m_tr.y, &m_tr.buff[m_tr.start], len, m_env.BITBLTBUF, m_env.TRXPOS, m_env.TRXREG);
@@ -1725,7 +1747,19 @@ void GSState::FlushPrim()
 		const bool skip_draw = (m_context->TEST.ZTE && m_context->TEST.ZTST == ZTST_NEVER);
 
 		if (!skip_draw)
+		{
+			if (m_async_write_pending_size > 0)
+			{
+				const GSVector4i scissor(m_context->SCISSOR.SCAX0, m_context->SCISSOR.SCAY0,
+					m_context->SCISSOR.SCAX1 + 1, m_context->SCISSOR.SCAY1 + 1);
+				WaitForPendingWrites(m_context->offset.fb, scissor);
+				WaitForPendingWrites(m_context->offset.zb, scissor);
+				if (PRIM->TME)
+					WaitForPendingTEX0Writes(m_context);
+			}
+
 			Draw();
+		}
 
 		g_perfmon.Put(GSPerfMon::Draw, 1);
 		g_perfmon.Put(GSPerfMon::Prim, m_index.tail / GSUtil::GetVertexCount(PRIM->PRIM));
@@ -1890,6 +1924,87 @@ void GSState::CheckWriteOverlap(bool req_write, bool req_read)
 	}
 }
 
+void GSState::QueueAsyncWrite(const u8* mem, int len, const GIFRegBITBLTBUF& blit, const GSVector4i& r)
+{
+	const GSOffset off = m_mem.GetOffset(blit.DBP, blit.DBW, blit.DPSM);
+
+	// Don't let the copies pile up indefinitely if nothing ever reads the memory back.
+	if ((m_async_write_pending_size + static_cast<size_t>(len)) > ASYNC_WRITE_MAX_PENDING)
+		WaitForPendingWrites();
+	else
+		WaitForPendingWrites(off, r);
+
+	// The source lives in the MTGS ring buffer, which will be reused as soon as we return.
+	GSAsyncWrite* item = m_async_write_heap.make<GSAsyncWrite>(
+		GSAsyncWrite{nullptr, len, m_tr.x, m_tr.y, blit, m_env.TRXPOS, m_env.TRXREG});
+	item->data = static_cast<u8*>(m_async_write_heap.alloc(len, 32));
+	std::memcpy(item->data, mem, len);
+
+	off.loopPages(r, [this](u32 page) { m_async_write_pages.set(page); });
+	m_async_write_pending_size += static_cast<size_t>(len);
+	m_async_write_tr_pending = true;
+	m_async_writes.push_back(item);
+
+	GSThreadPool::Queue(GSThreadPool::Priority::Upload, GSThreadPool::Group::AsyncWrite, [this, item]() {
+		GSLocalMemory::m_psm[item->blit.DPSM].wi(m_mem, item->x, item->y, item->data, item->len, item->blit, item->pos, item->reg);
+	});
+}
+
+void GSState::WaitForPendingWrites()
+{
+	if (m_async_write_pending_size == 0)
+		return;
+
+	GSThreadPool::Wait(GSThreadPool::Group::AsyncWrite);
+
+	// Keep the transfer position identical to the inline path, it ends up in savestates.
+	if (m_async_write_tr_pending)
+	{
+		m_tr.x = m_async_writes.back()->x;
+		m_tr.y = m_async_writes.back()->y;
+		m_async_write_tr_pending = false;
+	}
+
+	for (GSAsyncWrite* item : m_async_writes)
+	{
+		GSRingHeap::free(item->data);
+		GSRingHeap::destroy(item);
+	}
+
+	m_async_writes.clear();
+	m_async_write_pages.reset();
+	m_async_write_pending_size = 0;
+}
+
+void GSState::WaitForPendingWrites(const GSOffset& off, const GSVector4i& r)
+{
+	if (m_async_write_pending_size == 0)
+		return;
+
+	bool overlap = false;
+	off.pageLooperForRect(r).loopPagesWithBreak([this, &overlap](u32 page) {
+		overlap = m_async_write_pages.test(page);
+		return !overlap;
+	});
+
+	if (overlap)
+		WaitForPendingWrites();
+}
+
+void GSState::WaitForPendingTEX0Writes(const GSDrawingContext* ctx)
+{
+	// Mip levels can live anywhere, not worth tracking them individually.
+	if (ctx->TEX1.MXL > 0)
+	{
+		WaitForPendingWrites();
+		return;
+	}
+
+	const GIFRegTEX0& TEX0 = ctx->TEX0;
+	const GSVector4i r(0, 0, std::min(1 << TEX0.TW, 2048), std::min(1 << TEX0.TH, 2048));
+	WaitForPendingWrites(m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM), r);
+}
+
 void GSState::Write(const u8* mem, int len)
 {
 	if (m_env.TRXDIR.XDIR == 3)
@@ -1946,7 +2061,18 @@ void GSState::Write(const u8* mem, int len)
 			// received all data in one piece, no need to buffer it
 			InvalidateVideoMem(blit, r);
 
-			psm.wi(m_mem, m_tr.x, m_tr.y, mem, m_tr.total, blit, m_env.TRXPOS, m_env.TRXREG);
+			// Big uploads get swizzled in the background, anything which wraps around the 2048x2048 space stays inline.
+			if (m_tr.total >= ASYNC_WRITE_MIN_SIZE && r.rintersect(GSVector4i(0, 0, 2048, 2048)).eq(r))
+			{
+				QueueAsyncWrite(mem, m_tr.total, blit, r);
+			}
+			else
+			{
+				if (m_async_write_pending_size > 0)
+					WaitForPendingWrites(m_mem.GetOffset(blit.DBP, blit.DBW, blit.DPSM), r);
+
+				psm.wi(m_mem, m_tr.x, m_tr.y, mem, m_tr.total, blit, m_env.TRXPOS, m_env.TRXREG);
+			}
 
 			m_tr.start = m_tr.end = m_tr.total;
 
@@ -1980,6 +2106,7 @@ void GSState::InitReadFIFO(u8* mem, int len)
 	const u16 bpp = GSLocalMemory::m_psm[m_env.BITBLTBUF.SPSM].trbpp;
 
 	CheckWriteOverlap(false, true);
+	WaitForPendingWrites();
 
 	if (!m_tr.Update(w, h, bpp, len))
 		return;
@@ -2295,6 +2422,8 @@ void GSState::ReadLocalMemoryUnsync(u8* mem, int qwc, GIFRegBITBLTBUF BITBLTBUF,
 
 	const u16 bpp = GSLocalMemory::m_psm[BITBLTBUF.SPSM].trbpp;
 
+	WaitForPendingWrites();
+
 	GSTransferBuffer tb;
 
 	if(m_tr.end >= m_tr.total || m_tr.write == true)
@@ -2482,6 +2611,7 @@ void GSState::Transfer(const u8* mem, u32 size)
 						Write(mem, len * 16);
 						break;
 					case 2:
+						WaitForPendingWrites();
 						Move();
 						break;
 					default: // 1 and 3
@@ -7,12 +7,15 @@
 #include "GS/GSLocalMemory.h"
 #include "GS/GSDrawingContext.h"
 #include "GS/GSDrawingEnvironment.h"
+#include "GS/GSRingHeap.h"
 #include "GS/Renderers/Common/GSVertex.h"
 #include "GS/Renderers/Common/GSVertexTrace.h"
 #include "GS/Renderers/Common/GSDevice.h"
 #include "GS/GSVector.h"
 #include "GSAlignedClass.h"
 
+#include <bitset>
+
 class GSDumpBase;
 
 class GSState : public GSAlignedClass<32>
@@ -121,6 +124,31 @@ private:
 
 	} m_tr;
 
+	/// Large host->local transfers which arrive in one piece are swizzled on the GS thread pool.
+	/// The pages they cover stay marked until the pool has been waited on. Transfers in flight never
+	/// overlap each other, so it doesn't matter which order the pool finishes them in.
+	struct GSAsyncWrite
+	{
+		u8* data;
+		int len;
+		int x, y; ///< Written back by the swizzle.
+		GIFRegBITBLTBUF blit;
+		GIFRegTRXPOS pos;
+		GIFRegTRXREG reg;
+	};
+
+	static constexpr int ASYNC_WRITE_MIN_SIZE = 64 * 1024;
+	static constexpr size_t ASYNC_WRITE_MAX_PENDING = 16 * 1024 * 1024;
+
+	GSRingHeap m_async_write_heap;
+	std::vector<GSAsyncWrite*> m_async_writes;
+	std::bitset<MAX_PAGES> m_async_write_pages;
+	size_t m_async_write_pending_size = 0;
+	bool m_async_write_tr_pending = false; ///< m_tr.x/y are stale until the pool is waited on.
+
+	void QueueAsyncWrite(const u8* mem, int len, const GIFRegBITBLTBUF& blit, const GSVector4i& r);
+	void WaitForPendingTEX0Writes(const GSDrawingContext* ctx);
+
 protected:
 	static constexpr int INVALID_ALPHA_MINMAX = 500;
 
@@ -385,6 +413,10 @@ public:
 	virtual void UpdateSettings(const Pcsx2Config::GSOptions& old_config);
 
 	void Flush(GSFlushReason reason);
+	/// Waits for all queued asynchronous swizzles to land in local memory.
+	void WaitForPendingWrites();
+	/// Waits for queued asynchronous swizzles only if they touch the pages in the given rect.
+	void WaitForPendingWrites(const GSOffset& off, const GSVector4i& r);
 	u32 CalcMask(int exp, int max_exp);
 	void FlushPrim();
 	bool TestDrawChanged();
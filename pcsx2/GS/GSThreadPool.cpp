@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "GS/GSThreadPool.h"
+#include "Config.h"
+#include "VMManager.h"
+
+#include "common/Assertions.h"
+#include "common/Console.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GSThreadPool
+{
+	struct Task
+	{
+		Group group;
+		std::function<void()> fn;
+	};
+
+	struct PriorityStats
+	{
+		u64 tasks = 0;
+		Common::Timer::Value time = 0;
+	};
+
+	static void StartWorkers();
+	static void WorkerThreadEntryPoint(u32 index, u64 affinity);
+
+	static constexpr u32 NUM_WORKERS = 2;
+	static constexpr u32 NUM_PRIORITIES = static_cast<u32>(Priority::Count);
+	static constexpr u32 NUM_GROUPS = static_cast<u32>(Group::Count);
+
+	static const char* s_priority_names[NUM_PRIORITIES] = {"Upload", "Decode", "Background"};
+
+	static std::mutex s_mutex;
+	static std::condition_variable s_work_cv;
+	static std::condition_variable s_done_cv;
+	static std::vector<std::thread> s_workers;
+	static std::array<std::deque<Task>, NUM_PRIORITIES> s_queues;
+	static std::array<u32, NUM_GROUPS> s_group_outstanding = {};
+	static std::array<PriorityStats, NUM_PRIORITIES> s_stats = {};
+	static bool s_shutdown = false;
+} // namespace GSThreadPool
+
+void GSThreadPool::StartWorkers()
+{
+	// Keep out of the way of the EE/VU/GS threads when pinning, but let the OS pick within the remaining cores.
+	u64 affinity = 0;
+	if (EmuConfig.EnableThreadPinning)
+	{
+		for (const u32 proc : VMManager::Internal::GetSoftwareRendererProcessorList())
+		{
+			if (proc < 64)
+				affinity |= static_cast<u64>(1) << proc;
+		}
+	}
+
+	s_shutdown = false;
+	s_workers.reserve(NUM_WORKERS);
+	for (u32 i = 0; i < NUM_WORKERS; i++)
+		s_workers.emplace_back(&WorkerThreadEntryPoint, i, affinity);
+}
+
+void GSThreadPool::WorkerThreadEntryPoint(u32 index, u64 affinity)
+{
+	Threading::SetNameOfCurrentThread(fmt::format("GS-Pool-{}", index).c_str());
+	if (affinity != 0)
+		Threading::ThreadHandle::GetForCallingThread().SetAffinity(affinity);
+
+	std::unique_lock<std::mutex> lock(s_mutex);
+	for (;;)
+	{
+		u32 priority = 0;
+		for (; priority < NUM_PRIORITIES; priority++)
+		{
+			if (!s_queues[priority].empty())
+				break;
+		}
+
+		if (priority == NUM_PRIORITIES)
+		{
+			if (s_shutdown)
+				break;
+
+			s_work_cv.wait(lock);
+			continue;
+		}
+
+		Task task = std::move(s_queues[priority].front());
+		s_queues[priority].pop_front();
+		lock.unlock();
+
+		const Common::Timer::Value start = Common::Timer::GetCurrentValue();
+		task.fn();
+		const Common::Timer::Value elapsed = Common::Timer::GetCurrentValue() - start;
+
+		lock.lock();
+		s_stats[priority].tasks++;
+		s_stats[priority].time += elapsed;
+		if (--s_group_outstanding[static_cast<u32>(task.group)] == 0)
+			s_done_cv.notify_all();
+	}
+}
+
+void GSThreadPool::Queue(Priority priority, Group group, std::function<void()> fn)
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	if (s_workers.empty())
+		StartWorkers();
+
+	s_queues[static_cast<u32>(priority)].push_back(Task{group, std::move(fn)});
+	s_group_outstanding[static_cast<u32>(group)]++;
+	s_work_cv.notify_one();
+}
+
+void GSThreadPool::Wait(Group group)
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	s_done_cv.wait(lock, [group]() { return s_group_outstanding[static_cast<u32>(group)] == 0; });
+}
+
+void GSThreadPool::Cancel(Group group)
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	for (std::deque<Task>& queue : s_queues)
+	{
+		for (auto it = queue.begin(); it != queue.end();)
+		{
+			if (it->group == group)
+			{
+				it = queue.erase(it);
+				s_group_outstanding[static_cast<u32>(group)]--;
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	if (s_group_outstanding[static_cast<u32>(group)] == 0)
+		s_done_cv.notify_all();
+}
+
+void GSThreadPool::Shutdown()
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	if (s_workers.empty())
+		return;
+
+	// Workers drain the queues before exiting.
+	s_shutdown = true;
+	s_work_cv.notify_all();
+	lock.unlock();
+
+	for (std::thread& thread : s_workers)
+		thread.join();
+
+	lock.lock();
+	s_workers.clear();
+
+	for (u32 i = 0; i < NUM_PRIORITIES; i++)
+	{
+		if (s_stats[i].tasks == 0)
+			continue;
+
+		DEV_LOG("GS thread pool: {} {} tasks, {:.2f} ms total, {:.3f} ms avg", s_stats[i].tasks, s_priority_names[i],
+			Common::Timer::ConvertValueToMilliseconds(s_stats[i].time),
+			Common::Timer::ConvertValueToMilliseconds(s_stats[i].time) / static_cast<double>(s_stats[i].tasks));
+	}
+
+	s_stats = {};
+	pxAssert(std::all_of(s_group_outstanding.begin(), s_group_outstanding.end(), [](u32 v) { return v == 0; }));
+}
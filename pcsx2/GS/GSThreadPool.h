@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Types.h"
+
+#include <functional>
+
+/// Small pool of sleeping worker threads shared by the GS helpers which don't need a dedicated thread.
+/// The software rasterizer keeps its own per-thread queues, since every thread has to see every draw
+/// in order, so it effectively sits above everything queued here.
+namespace GSThreadPool
+{
+	/// Queued work is picked in this order.
+	enum class Priority : u8
+	{
+		Upload, ///< Local memory swizzles, the GS thread may be waiting on these.
+		Decode, ///< Texture replacement loads which are wanted right now.
+		Background, ///< Precaching and texture dumping.
+		Count
+	};
+
+	/// Tasks are tagged with their owner, so they can be waited on or cancelled without touching anyone else's.
+	enum class Group : u8
+	{
+		AsyncWrite,
+		TextureReplacements,
+		Count
+	};
+
+	/// Queues a task, starting the worker threads if they aren't running yet.
+	void Queue(Priority priority, Group group, std::function<void()> fn);
+
+	/// Blocks until every task in the group has finished executing.
+	void Wait(Group group);
+
+	/// Drops any tasks in the group which haven't started yet. Running tasks are left alone.
+	void Cancel(Group group);
+
+	/// Waits for all outstanding work and stops the worker threads.
+	void Shutdown();
+} // namespace GSThreadPool
@@ -738,9 +738,21 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 				Host::OSD_INFO_DURATION);
 			m_dump.reset();
 		}
-		else if (!last)
+		else
 		{
-			m_dump_frames--;
+			if (!last)
+				m_dump_frames--;
+
+			// periodic state snapshots let the replayer start from the middle of long dumps
+			if (m_dump->NeedsKeyframe(GSConfig.GSDumpKeyframeInterval))
+			{
+				freezeData fd = {0, nullptr};
+				Freeze(&fd, true);
+				std::unique_ptr<u8[]> data = std::make_unique<u8[]>(fd.size);
+				fd.data = data.get();
+				if (Freeze(&fd, false) == 0)
+					m_dump->Keyframe(GSConfig.GSDumpKeyframeInterval, fd, m_regs);
+			}
 		}
 	}
 
@@ -56,6 +56,7 @@ void GSRendererHW::PurgeTextureCache(bool sources, bool targets, bool hash_cache
 
 void GSRendererHW::ReadbackTextureCache()
 {
+	WaitForPendingWrites();
 	g_texture_cache->ReadbackAll();
 }
 
@@ -6209,6 +6209,9 @@ void GSTextureCache::Target::Update(bool cannot_scale)
 	const GSOffset off(g_gs_renderer->m_mem.GetOffset(m_TEX0.TBP0, m_TEX0.TBW, m_TEX0.PSM));
 	const u32 bpp = GSLocalMemory::m_psm[m_TEX0.PSM].bpp;
 
+	// Large uploads are swizzled in the background, make sure they've landed before we read local memory back.
+	g_gs_renderer->WaitForPendingWrites(off, total_rect);
+
 	std::pair<u8, u8> alpha_minmax = {255, 0};
 	bool transferring_alpha = false;
 
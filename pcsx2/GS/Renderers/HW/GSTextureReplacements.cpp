@@ -15,19 +15,17 @@
 #include "IconsFontAwesome5.h"
 #include "GS/GSExtra.h"
 #include "GS/GSLocalMemory.h"
+#include "GS/GSThreadPool.h"
 #include "GS/Renderers/HW/GSTextureReplacements.h"
 #include "VMManager.h"
 
 #include <cinttypes>
-#include <condition_variable>
 #include <cstring>
-#include <deque>
 #include <functional>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <tuple>
-#include <thread>
 
 // this is a #define instead of a variable to avoid warnings from non-literal format strings
 #define TEXTURE_FILENAME_FORMAT_STRING "%" PRIx64 "-%08x"
@@ -113,11 +111,10 @@ namespace GSTextureReplacements
 	static void PrecacheReplacementTextures();
 	static void ClearReplacementTextures();
 
-	static void StartWorkerThread();
-	static void StopWorkerThread();
-	static void QueueWorkerThreadItem(std::function<void()> fn, bool high_priority);
-	static void WorkerThreadEntryPoint();
-	static void SyncWorkerThread();
+	static void StartWorker();
+	static void StopWorker();
+	static void QueueWorkerItem(std::function<void()> fn, bool high_priority);
+	static void SyncWorker();
 	static void CancelPendingLoadsAndDumps();
 
 	static std::string s_current_serial;
@@ -142,12 +139,8 @@ namespace GSTextureReplacements
 	/// Second element is whether the texture should be created with mipmaps.
 	static std::vector<std::pair<TextureName, bool>> s_async_loaded_textures;
 
-	/// Loader/dumper thread.
-	static std::thread s_worker_thread;
-	static std::mutex s_worker_thread_mutex;
-	static std::condition_variable s_worker_thread_cv;
-	static std::deque<std::pair<std::function<void()>, bool>> s_worker_thread_queue;
-	static bool s_worker_thread_running = false;
+	/// Whether loads/dumps can be queued on the GS thread pool.
+	static bool s_worker_running = false;
 }; // namespace GSTextureReplacements
 
 TextureName GSTextureReplacements::CreateTextureName(const GSTextureCache::HashCacheKey& hash, u32 miplevel)
@@ -333,7 +326,7 @@ void GSTextureReplacements::Initialize()
 	s_current_serial = VMManager::GetDiscSerial();
 
 	if (GSConfig.DumpReplaceableTextures || GSConfig.LoadTextureReplacements)
-		StartWorkerThread();
+		StartWorker();
 
 	ReloadReplacementMap();
 }
@@ -351,7 +344,7 @@ void GSTextureReplacements::GameChanged()
 
 void GSTextureReplacements::ReloadReplacementMap()
 {
-	SyncWorkerThread();
+	SyncWorker();
 
 	// clear out the caches
 	{
@@ -412,10 +405,10 @@ void GSTextureReplacements::ReloadReplacementMap()
 void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 {
 	// get rid of worker thread if it's no longer needed
-	if (s_worker_thread_running && !GSConfig.DumpReplaceableTextures && !GSConfig.LoadTextureReplacements)
-		StopWorkerThread();
-	if (!s_worker_thread_running && (GSConfig.DumpReplaceableTextures || GSConfig.LoadTextureReplacements))
-		StartWorkerThread();
+	if (s_worker_running && !GSConfig.DumpReplaceableTextures && !GSConfig.LoadTextureReplacements)
+		StopWorker();
+	if (!s_worker_running && (GSConfig.DumpReplaceableTextures || GSConfig.LoadTextureReplacements))
+		StartWorker();
 
 	if ((!GSConfig.DumpReplaceableTextures && old_config.DumpReplaceableTextures) ||
 		(!GSConfig.LoadTextureReplacements && old_config.LoadTextureReplacements))
@@ -437,7 +430,7 @@ void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 
 void GSTextureReplacements::Shutdown()
 {
-	StopWorkerThread();
+	StopWorker();
 
 	std::string().swap(s_current_serial);
 	ClearReplacementTextures();
@@ -624,7 +617,7 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 	}
 
 	s_pending_async_load_textures.emplace(name, cache_only);
-	QueueWorkerThreadItem([name, filename, mipmap]() {
+	QueueWorkerItem([name, filename, mipmap]() {
 		// actually load the file, this is what will take the time
 		std::optional<ReplacementTexture> replacement(LoadReplacementTexture(name, filename, !mipmap));
 
@@ -792,7 +785,7 @@ void GSTextureReplacements::DumpTexture(const GSTextureCache::HashCacheKey& hash
 
 	// okay, now we can actually dump it
 	const u32 buffer_offset = ((rect.top - block_rect.top) * pitch) + ((rect.left - block_rect.left) * sizeof(u32));
-	QueueWorkerThreadItem([filename = std::move(filename), tw, th, pitch, buffer, buffer_offset]() {
+	QueueWorkerItem([filename = std::move(filename), tw, th, pitch, buffer, buffer_offset]() {
 		if (!SavePNGImage(filename.c_str(), tw, th, buffer + buffer_offset, pitch))
 			Console.Error(fmt::format("Failed to dump texture to '{}'.", filename));
 		_aligned_free(buffer);
@@ -805,117 +798,43 @@ void GSTextureReplacements::ClearDumpedTextureList()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Worker Thread
+// Worker
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void GSTextureReplacements::StartWorkerThread()
+void GSTextureReplacements::StartWorker()
 {
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-
-	if (s_worker_thread.joinable())
-		return;
-
-	s_worker_thread_running = true;
-	s_worker_thread = std::thread(WorkerThreadEntryPoint);
+	s_worker_running = true;
 }
 
-void GSTextureReplacements::StopWorkerThread()
+void GSTextureReplacements::StopWorker()
 {
-	{
-		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-		if (!s_worker_thread.joinable())
-			return;
-
-		s_worker_thread_running = false;
-		s_worker_thread_cv.notify_one();
-	}
+	if (!s_worker_running)
+		return;
 
-	s_worker_thread.join();
+	s_worker_running = false;
 
 	// clear out workery-things too
 	CancelPendingLoadsAndDumps();
 }
 
-void GSTextureReplacements::QueueWorkerThreadItem(std::function<void()> fn, bool high_priority)
+void GSTextureReplacements::QueueWorkerItem(std::function<void()> fn, bool high_priority)
 {
-	pxAssert(s_worker_thread.joinable());
-
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!high_priority)
-	{
-		// Low priority => throw on end.
-		s_worker_thread_queue.emplace_back(std::move(fn), false);
-	}
-	else
-	{
-		auto iter = s_worker_thread_queue.rbegin();
-		for (; iter != s_worker_thread_queue.rend(); ++iter)
-		{
-			// Found our first high priority item?
-			if (iter->second)
-			{
-				// Insert after here!
-				break;
-			}
-		}
+	pxAssert(s_worker_running);
 
-		if (iter != s_worker_thread_queue.rend())
-		{
-			// Insert after the last high priority item. Remember base() points to the next element.
-			s_worker_thread_queue.insert(iter.base(), std::make_pair(std::move(fn), true));
-		}
-		else
-		{
-			// All low-priority => insert at beginning.
-			s_worker_thread_queue.emplace_front(std::move(fn), true);
-		}
-	}
-
-	s_worker_thread_cv.notify_one();
+	// Loads which the texture cache is waiting on jump ahead of precaching and dumping.
+	GSThreadPool::Queue(high_priority ? GSThreadPool::Priority::Decode : GSThreadPool::Priority::Background,
+		GSThreadPool::Group::TextureReplacements, std::move(fn));
 }
 
-void GSTextureReplacements::WorkerThreadEntryPoint()
+void GSTextureReplacements::SyncWorker()
 {
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	while (s_worker_thread_running)
-	{
-		if (s_worker_thread_queue.empty())
-		{
-			s_worker_thread_cv.wait(lock);
-			continue;
-		}
-
-		std::function<void()> fn = std::move(s_worker_thread_queue.front().first);
-		s_worker_thread_queue.pop_front();
-		lock.unlock();
-		fn();
-		lock.lock();
-	}
-}
-
-void GSTextureReplacements::SyncWorkerThread()
-{
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!s_worker_thread.joinable())
-		return;
-
-	// not the most efficient by far, but it only gets called on config changes, so whatever
-	for (;;)
-	{
-		if (s_worker_thread_queue.empty())
-			break;
-
-		lock.unlock();
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
-		lock.lock();
-	}
+	GSThreadPool::Wait(GSThreadPool::Group::TextureReplacements);
 }
 
 void GSTextureReplacements::CancelPendingLoadsAndDumps()
 {
-	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	while (!s_worker_thread_queue.empty())
-		s_worker_thread_queue.pop_back();
+	GSThreadPool::Cancel(GSThreadPool::Group::TextureReplacements);
+	GSThreadPool::Wait(GSThreadPool::Group::TextureReplacements);
 	s_async_loaded_textures.clear();
 	s_pending_async_load_textures.clear();
 }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "GS.h"
+#include "GS/GSDump.h"
 #include "GS/GSLzma.h"
 #include "GSDumpReplayer.h"
 #include "GameList.h"
@@ -39,6 +40,7 @@ static void GSDumpReplayerCpuClear(u32 addr, u32 size);
 static std::unique_ptr<GSDumpFile> s_dump_file;
 static u32 s_current_packet = 0;
 static u32 s_dump_frame_number = 0;
+static u32 s_dump_start_frame = 0;
 static s32 s_dump_loop_count = 0;
 static bool s_dump_running = false;
 static bool s_needs_state_loaded = false;
@@ -84,6 +86,11 @@ int GSDumpReplayer::GetLoopCount()
 	return s_dump_loop_count;
 }
 
+void GSDumpReplayer::SetStartFrame(u32 frame)
+{
+	s_dump_start_frame = frame;
+}
+
 bool GSDumpReplayer::Initialize(const char* filename)
 {
 	Common::Timer timer;
@@ -133,7 +140,6 @@ bool GSDumpReplayer::ChangeDump(const char* filename)
 	}
 
 	s_dump_file = std::move(new_dump);
-	s_current_packet = 0;
 
 	// Don't forget to reset the GS!
 	GSDumpReplayerCpuReset();
@@ -195,6 +201,9 @@ void GSDumpReplayerCpuReset()
 	s_needs_state_loaded = true;
 	s_current_packet = 0;
 	s_dump_frame_number = 0;
+
+	if (s_dump_file)
+		s_dump_file->RestartPackets();
 }
 
 static void GSDumpReplayerLoadInitialState()
@@ -212,6 +221,58 @@ static void GSDumpReplayerLoadInitialState()
 		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to load GS state.");
 }
 
+static void GSDumpReplayerLoadKeyframe(const GSDumpFile::GSData& packet)
+{
+	const u8* state_data = packet.data + sizeof(GSDumpKeyframeHeader);
+	const size_t state_size = packet.length - sizeof(GSDumpKeyframeHeader) - Ps2MemSize::GSregs;
+	std::memcpy(PS2MEM_GS, state_data + state_size, Ps2MemSize::GSregs);
+
+	freezeData fd = {static_cast<int>(state_size), const_cast<u8*>(state_data)};
+	MTGS::FreezeData mfd = {&fd, 0};
+	MTGS::Freeze(FreezeAction::Load, mfd);
+	if (mfd.retval != 0)
+		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to load GS keyframe.");
+}
+
+/// Skips packets without sending them to the GS until the keyframe covering the start frame, and loads it.
+/// Falls back to replaying from the beginning if the dump has no such keyframe.
+static void GSDumpReplayerSeekToStartFrame()
+{
+	Common::Timer timer;
+	u32 frame = 0;
+	u32 packets = 0;
+	while (const GSDumpFile::GSData* packet = s_dump_file->GetNextPacket())
+	{
+		packets++;
+
+		if (packet->id == GSDumpTypes::GSType::VSync)
+		{
+			// went past the start frame without seeing a keyframe for it
+			if (++frame > s_dump_start_frame)
+				break;
+		}
+		else if (packet->id == GSDumpTypes::GSType::State &&
+				 packet->length >= (sizeof(GSDumpKeyframeHeader) + Ps2MemSize::GSregs))
+		{
+			GSDumpKeyframeHeader header;
+			std::memcpy(&header, packet->data, sizeof(header));
+			if (header.frame <= s_dump_start_frame &&
+				(header.interval == 0 || (s_dump_start_frame - header.frame) < header.interval))
+			{
+				GSDumpReplayerLoadKeyframe(*packet);
+				s_current_packet = packets;
+				s_dump_frame_number = header.frame;
+				Console.WriteLn("(GSDumpReplayer) Seeked to keyframe at frame %u in %.2f ms.", header.frame,
+					timer.GetTimeMilliseconds());
+				return;
+			}
+		}
+	}
+
+	Console.Warning("(GSDumpReplayer) No keyframe found for frame %u, replaying from the start.", s_dump_start_frame);
+	s_dump_file->RestartPackets();
+}
+
 static void GSDumpReplayerSendPacketToMTGS(GIF_PATH path, const u8* data, u32 length)
 {
 	pxAssert((length % 16) == 0);
@@ -259,12 +320,16 @@ void GSDumpReplayerCpuStep()
 	{
 		GSDumpReplayerLoadInitialState();
 		s_needs_state_loaded = false;
+
+		if (s_dump_start_frame > 0)
+			GSDumpReplayerSeekToStartFrame();
 	}
 
-	const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[s_current_packet];
-	s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
-	if (s_current_packet == 0)
+	const GSDumpFile::GSData* next_packet = s_dump_file->GetNextPacket();
+	if (!next_packet)
 	{
+		// end of the dump, start streaming it again from the beginning
+		s_current_packet = 0;
 		s_dump_frame_number = 0;
 		if (s_dump_loop_count > 0)
 			s_dump_loop_count--;
@@ -272,9 +337,31 @@ void GSDumpReplayerCpuStep()
 		{
 			Host::RequestVMShutdown(false, false, false);
 			s_dump_running = false;
+			return;
+		}
+
+		s_dump_file->RestartPackets();
+
+		// the GS state has to come from a keyframe again
+		if (s_dump_start_frame > 0)
+		{
+			s_needs_state_loaded = true;
+			return;
+		}
+
+		next_packet = s_dump_file->GetNextPacket();
+		if (!next_packet)
+		{
+			Host::ReportErrorAsync("GSDumpReplayer", "Dump contains no packets.");
+			Host::RequestVMShutdown(false, false, false);
+			s_dump_running = false;
+			return;
 		}
 	}
 
+	const GSDumpFile::GSData& packet = *next_packet;
+	s_current_packet++;
+
 	switch (packet.id)
 	{
 		case GSDumpTypes::GSType::Transfer:
@@ -334,6 +421,10 @@ void GSDumpReplayerCpuStep()
 			std::memcpy(PS2MEM_GS, packet.data, std::min<s32>(packet.length, Ps2MemSize::GSregs));
 		}
 		break;
+
+		case GSDumpTypes::GSType::State:
+			// keyframes are only needed for seeking, the replayed state already matches
+			break;
 	}
 }
 
@@ -388,7 +479,10 @@ void GSDumpReplayer::RenderUI()
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 	text.clear();
-	fmt::format_to(std::back_inserter(text), "Packet Number: {}/{}", s_current_packet, static_cast<u32>(s_dump_file->GetPackets().size()));
+	if (s_dump_file->GetPacketCount() > 0)
+		fmt::format_to(std::back_inserter(text), "Packet Number: {}/{}", s_current_packet, s_dump_file->GetPacketCount());
+	else
+		fmt::format_to(std::back_inserter(text), "Packet Number: {}", s_current_packet);
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 #undef DRAW_LINE
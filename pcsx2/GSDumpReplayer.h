@@ -14,6 +14,9 @@ namespace GSDumpReplayer
 	void SetLoopCount(s32 loop_count = 0);
 	int GetLoopCount();
 	bool IsRunner();
+
+	/// Starts playback at the given frame, from the closest keyframe before it when the dump has them.
+	void SetStartFrame(u32 frame);
 	void SetIsDumpRunner(bool is_runner);
 
 	bool Initialize(const char* filename);
@@ -7,10 +7,12 @@
 #include "IconsFontAwesome5.h"
 #include "vtlb.h"
 
+#include "common/BitUtils.h"
 #include "common/Console.h"
 #include "common/EnumOps.h"
 #include "common/Error.h"
 #include "common/FileSystem.h"
+#include "common/HostSys.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
 #include "common/Timer.h"
@@ -20,6 +22,8 @@
 #include "ryml.hpp"
 #include "fmt/core.h"
 #include "fmt/ranges.h"
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
 #include <mutex>
 #include <optional>
@@ -34,14 +38,95 @@ namespace GameDatabaseSchema
 namespace GameDatabase
 {
 	static void parseAndInsert(const std::string_view serial, const c4::yml::NodeRef& node);
+	static void parseYamlDatabase(const std::string& path);
 	static void initDatabase();
+
+	static std::string getBinaryDatabasePath();
+	static bool openBinaryDatabase(const FILESYSTEM_STAT_DATA& source_sd);
+	static void writeBinaryDatabase(const FILESYSTEM_STAT_DATA& source_sd);
+	static const GameDatabaseSchema::GameEntry* decodeBinaryEntry(const std::string& serial);
 } // namespace GameDatabase
 
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_BINARY_FILE_NAME[] = "gamedb.cache";
+
+// The binary database is a compiled copy of the YAML, written to the cache directory the first time
+// the YAML is parsed. Entries are only decoded when they are looked up, and the file is mapped
+// read-only so instances running side by side share it. The YAML stays the source of truth: the
+// binary is rebuilt whenever the YAML's size or timestamp no longer match the header, or the build
+// reading it lays out the serialized types differently from the one which wrote it.
+enum : u32
+{
+	GAMEDB_BINARY_SIGNATURE = 0x42444750, // PGDB
+	GAMEDB_BINARY_VERSION = 2, // Bump when GameEntry or its serialization changes.
+};
+
+struct GameDBBinaryHeader
+{
+	u32 signature;
+	u32 version;
+	u32 layout;
+	u32 pad;
+	u64 source_size;
+	s64 source_timestamp;
+	u32 num_entries;
+	u32 index_offset;
+};
+
+// Sorted by hash. Each entry points to a length-prefixed serial followed by the serialized GameEntry.
+struct GameDBBinaryIndexEntry
+{
+	u64 hash;
+	u32 offset;
+	u32 pad;
+};
+
+// Everything which is copied into the file as raw bytes, and the enum ranges stored in it. Catches
+// changes which should have bumped GAMEDB_BINARY_VERSION, and builds disagreeing on type sizes.
+static constexpr u32 getBinaryLayoutSignature()
+{
+	constexpr u32 values[] = {
+		sizeof(GameDBBinaryHeader),
+		sizeof(GameDBBinaryIndexEntry),
+		sizeof(Patch::DynamicPatchEntry),
+		offsetof(Patch::DynamicPatchEntry, offset),
+		offsetof(Patch::DynamicPatchEntry, value),
+		sizeof(GameDatabaseSchema::Compatibility),
+		static_cast<u32>(GameDatabaseSchema::Compatibility::Perfect),
+		sizeof(FPRoundMode),
+		static_cast<u32>(FPRoundMode::MaxCount),
+		sizeof(GameDatabaseSchema::ClampMode),
+		static_cast<u32>(GameDatabaseSchema::ClampMode::Count),
+		sizeof(GamefixId),
+		static_cast<u32>(GamefixId_COUNT),
+		sizeof(SpeedHack),
+		static_cast<u32>(SpeedHack::MaxCount),
+		sizeof(GameDatabaseSchema::GSHWFixId),
+		static_cast<u32>(GameDatabaseSchema::GSHWFixId::Count),
+		sizeof(decltype(GameDatabaseSchema::GameEntry::speedHacks)::value_type::second_type),
+		sizeof(decltype(GameDatabaseSchema::GameEntry::gsHWFixes)::value_type::second_type),
+	};
+
+	// FNV-1a over the values.
+	u32 hash = 0x811c9dc5u;
+	for (const u32 value : values)
+	{
+		hash ^= value;
+		hash *= 0x01000193u;
+	}
+	return hash;
+}
+
+static constexpr u32 GAMEDB_BINARY_LAYOUT = getBinaryLayoutSignature();
 
 static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
+static std::mutex s_game_db_mutex;
 static std::once_flag s_load_once_flag;
 
+static const u8* s_binary_db = nullptr;
+static size_t s_binary_db_size = 0;
+static const GameDBBinaryHeader* s_binary_db_header = nullptr;
+
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
 	return fmt::to_string(fmt::join(memcardFilters, "/"));
@@ -939,7 +1024,7 @@ void GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 	}
 }
 
-void GameDatabase::initDatabase()
+void GameDatabase::parseYamlDatabase(const std::string& path)
 {
 	ryml::Callbacks rymlCallbacks = ryml::get_callbacks();
 	rymlCallbacks.m_error = [](const char* msg, size_t msg_len, ryml::Location loc, void* userdata) {
@@ -951,7 +1036,7 @@ void GameDatabase::initDatabase()
 		Console.Error(fmt::format("[GameDB YAML] Internal Parsing error: {}", std::string_view(msg, msg_size)));
 	});
 
-	auto buf = FileSystem::ReadFileToString(Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME).c_str());
+	auto buf = FileSystem::ReadFileToString(path.c_str());
 	if (!buf.has_value())
 	{
 		Console.Error("[GameDB] Unable to open GameDB file, file does not exist.");
@@ -984,13 +1069,384 @@ void GameDatabase::initDatabase()
 	ryml::reset_callbacks();
 }
 
+namespace
+{
+	class GameDBBinaryWriter
+	{
+	public:
+		std::vector<u8>& data() { return m_data; }
+
+		template <typename T>
+		void write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const size_t pos = m_data.size();
+			m_data.resize(pos + sizeof(T));
+			std::memcpy(&m_data[pos], &value, sizeof(T));
+		}
+
+		void writeString(const std::string_view str)
+		{
+			write(static_cast<u32>(str.size()));
+			m_data.insert(m_data.end(), str.begin(), str.end());
+		}
+
+	private:
+		std::vector<u8> m_data;
+	};
+
+	// Bounds checked, since the file can be modified behind our back.
+	class GameDBBinaryReader
+	{
+	public:
+		GameDBBinaryReader(const u8* data, size_t size, size_t offset)
+			: m_ptr(data + std::min(offset, size))
+			, m_end(data + size)
+			, m_ok(offset <= size)
+		{
+		}
+
+		bool ok() const { return m_ok; }
+
+		template <typename T>
+		bool read(T* value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			if (!m_ok || static_cast<size_t>(m_end - m_ptr) < sizeof(T))
+				return (m_ok = false);
+
+			std::memcpy(value, m_ptr, sizeof(T));
+			m_ptr += sizeof(T);
+			return true;
+		}
+
+		std::string_view readString()
+		{
+			u32 len;
+			if (!read(&len) || static_cast<size_t>(m_end - m_ptr) < len)
+			{
+				m_ok = false;
+				return {};
+			}
+
+			const std::string_view ret(reinterpret_cast<const char*>(m_ptr), len);
+			m_ptr += len;
+			return ret;
+		}
+
+		template <typename T>
+		bool readEnum(T* value)
+		{
+			std::underlying_type_t<T> raw;
+			if (!read(&raw))
+				return false;
+
+			*value = static_cast<T>(raw);
+			return true;
+		}
+
+	private:
+		const u8* m_ptr;
+		const u8* m_end;
+		bool m_ok;
+	};
+} // namespace
+
+static u64 hashSerial(const std::string_view serial)
+{
+	// FNV-1a, the hash has to be stable across builds since it's stored in the file.
+	u64 hash = 0xcbf29ce484222325ull;
+	for (const char ch : serial)
+	{
+		hash ^= static_cast<u8>(ch);
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+static void serializeEntry(GameDBBinaryWriter& writer, const GameDatabaseSchema::GameEntry& entry)
+{
+	writer.writeString(entry.name);
+	writer.writeString(entry.name_sort);
+	writer.writeString(entry.name_en);
+	writer.writeString(entry.region);
+	writer.write(entry.compat);
+	writer.write(entry.eeRoundMode);
+	writer.write(entry.eeDivRoundMode);
+	writer.write(entry.vu0RoundMode);
+	writer.write(entry.vu1RoundMode);
+	writer.write(entry.eeClampMode);
+	writer.write(entry.vu0ClampMode);
+	writer.write(entry.vu1ClampMode);
+
+	writer.write(static_cast<u32>(entry.gameFixes.size()));
+	for (const GamefixId id : entry.gameFixes)
+		writer.write(id);
+
+	writer.write(static_cast<u32>(entry.speedHacks.size()));
+	for (const auto& [id, value] : entry.speedHacks)
+	{
+		writer.write(id);
+		writer.write(value);
+	}
+
+	writer.write(static_cast<u32>(entry.gsHWFixes.size()));
+	for (const auto& [id, value] : entry.gsHWFixes)
+	{
+		writer.write(id);
+		writer.write(value);
+	}
+
+	writer.write(static_cast<u32>(entry.memcardFilters.size()));
+	for (const std::string& filter : entry.memcardFilters)
+		writer.writeString(filter);
+
+	writer.write(static_cast<u32>(entry.patches.size()));
+	for (const auto& [crc, patch] : entry.patches)
+	{
+		writer.write(crc);
+		writer.writeString(patch);
+	}
+
+	writer.write(static_cast<u32>(entry.dynaPatches.size()));
+	for (const Patch::DynamicPatch& patch : entry.dynaPatches)
+	{
+		writer.write(static_cast<u32>(patch.pattern.size()));
+		for (const Patch::DynamicPatchEntry& pe : patch.pattern)
+			writer.write(pe);
+		writer.write(static_cast<u32>(patch.replacement.size()));
+		for (const Patch::DynamicPatchEntry& pe : patch.replacement)
+			writer.write(pe);
+	}
+}
+
+static bool deserializeEntry(GameDBBinaryReader& reader, GameDatabaseSchema::GameEntry* entry)
+{
+	entry->name = reader.readString();
+	entry->name_sort = reader.readString();
+	entry->name_en = reader.readString();
+	entry->region = reader.readString();
+	reader.readEnum(&entry->compat);
+	reader.readEnum(&entry->eeRoundMode);
+	reader.readEnum(&entry->eeDivRoundMode);
+	reader.readEnum(&entry->vu0RoundMode);
+	reader.readEnum(&entry->vu1RoundMode);
+	reader.readEnum(&entry->eeClampMode);
+	reader.readEnum(&entry->vu0ClampMode);
+	reader.readEnum(&entry->vu1ClampMode);
+
+	u32 count = 0;
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+			reader.readEnum(&entry->gameFixes.emplace_back());
+	}
+
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+		{
+			auto& [id, value] = entry->speedHacks.emplace_back();
+			reader.readEnum(&id);
+			reader.read(&value);
+		}
+	}
+
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+		{
+			auto& [id, value] = entry->gsHWFixes.emplace_back();
+			reader.readEnum(&id);
+			reader.read(&value);
+		}
+	}
+
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+			entry->memcardFilters.emplace_back(reader.readString());
+	}
+
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+		{
+			u32 crc = 0;
+			reader.read(&crc);
+			entry->patches.emplace(crc, reader.readString());
+		}
+	}
+
+	if (reader.read(&count))
+	{
+		for (u32 i = 0; i < count && reader.ok(); i++)
+		{
+			Patch::DynamicPatch& patch = entry->dynaPatches.emplace_back();
+			u32 num_entries = 0;
+			reader.read(&num_entries);
+			for (u32 j = 0; j < num_entries && reader.ok(); j++)
+				reader.read(&patch.pattern.emplace_back());
+			reader.read(&num_entries);
+			for (u32 j = 0; j < num_entries && reader.ok(); j++)
+				reader.read(&patch.replacement.emplace_back());
+		}
+	}
+
+	return reader.ok();
+}
+
+std::string GameDatabase::getBinaryDatabasePath()
+{
+	return Path::Combine(EmuFolders::Cache, GAMEDB_BINARY_FILE_NAME);
+}
+
+std::vector<u8> GameDatabase::serializeBinaryDatabase(
+	const std::unordered_map<std::string, GameDatabaseSchema::GameEntry>& db, u64 source_size, s64 source_timestamp)
+{
+	GameDBBinaryWriter writer;
+	writer.data().reserve(4 * _1mb);
+	writer.write(GameDBBinaryHeader{});
+
+	std::vector<GameDBBinaryIndexEntry> index;
+	index.reserve(db.size());
+	for (const auto& [serial, entry] : db)
+	{
+		index.push_back({hashSerial(serial), static_cast<u32>(writer.data().size()), 0});
+		writer.writeString(serial);
+		serializeEntry(writer, entry);
+	}
+
+	std::sort(index.begin(), index.end(),
+		[](const GameDBBinaryIndexEntry& lhs, const GameDBBinaryIndexEntry& rhs) { return lhs.hash < rhs.hash; });
+
+	writer.data().resize(Common::AlignUpPow2(writer.data().size(), alignof(GameDBBinaryIndexEntry)));
+	const GameDBBinaryHeader header = {GAMEDB_BINARY_SIGNATURE, GAMEDB_BINARY_VERSION, GAMEDB_BINARY_LAYOUT, 0,
+		source_size, source_timestamp, static_cast<u32>(index.size()), static_cast<u32>(writer.data().size())};
+	for (const GameDBBinaryIndexEntry& ie : index)
+		writer.write(ie);
+	std::memcpy(writer.data().data(), &header, sizeof(header));
+
+	return std::move(writer.data());
+}
+
+bool GameDatabase::isBinaryDatabaseValid(const u8* data, size_t size, u64 source_size, s64 source_timestamp)
+{
+	if (size < sizeof(GameDBBinaryHeader))
+		return false;
+
+	GameDBBinaryHeader header;
+	std::memcpy(&header, data, sizeof(header));
+	return (header.signature == GAMEDB_BINARY_SIGNATURE && header.version == GAMEDB_BINARY_VERSION &&
+			header.layout == GAMEDB_BINARY_LAYOUT && header.source_size == source_size &&
+			header.source_timestamp == source_timestamp && header.index_offset <= size &&
+			(header.index_offset % alignof(GameDBBinaryIndexEntry)) == 0 &&
+			(size - header.index_offset) / sizeof(GameDBBinaryIndexEntry) >= header.num_entries);
+}
+
+bool GameDatabase::decodeBinaryDatabaseEntry(
+	const u8* data, size_t size, const std::string_view serial, GameDatabaseSchema::GameEntry* entry)
+{
+	const GameDBBinaryHeader* header = reinterpret_cast<const GameDBBinaryHeader*>(data);
+	const u64 hash = hashSerial(serial);
+	const GameDBBinaryIndexEntry* index = reinterpret_cast<const GameDBBinaryIndexEntry*>(data + header->index_offset);
+	const GameDBBinaryIndexEntry* index_end = index + header->num_entries;
+	for (const GameDBBinaryIndexEntry* it = std::lower_bound(index, index_end, hash,
+			 [](const GameDBBinaryIndexEntry& ie, u64 value) { return ie.hash < value; });
+		 it != index_end && it->hash == hash; ++it)
+	{
+		GameDBBinaryReader reader(data, size, it->offset);
+		if (reader.readString() != serial)
+			continue;
+
+		if (!deserializeEntry(reader, entry))
+		{
+			Console.Error(fmt::format("[GameDB] Corrupted binary database entry for '{}'.", serial));
+			return false;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+bool GameDatabase::openBinaryDatabase(const FILESYSTEM_STAT_DATA& source_sd)
+{
+	const std::string path = getBinaryDatabasePath();
+	size_t size;
+	void* mapping = HostSys::MapFileReadOnly(path.c_str(), &size);
+	if (!mapping)
+		return false;
+
+	if (!isBinaryDatabaseValid(static_cast<const u8*>(mapping), size, static_cast<u64>(source_sd.Size),
+			static_cast<s64>(source_sd.ModificationTime)))
+	{
+		Console.WriteLn("[GameDB] Binary database is out of date, rebuilding.");
+		HostSys::UnmapFile(mapping, size);
+		return false;
+	}
+
+	s_binary_db = static_cast<const u8*>(mapping);
+	s_binary_db_size = size;
+	s_binary_db_header = static_cast<const GameDBBinaryHeader*>(mapping);
+	return true;
+}
+
+void GameDatabase::writeBinaryDatabase(const FILESYSTEM_STAT_DATA& source_sd)
+{
+	const std::vector<u8> data =
+		serializeBinaryDatabase(s_game_db, static_cast<u64>(source_sd.Size), static_cast<s64>(source_sd.ModificationTime));
+
+	// Write to a temporary file and rename it into place, other instances may be reading the old one.
+	const std::string path = getBinaryDatabasePath();
+	const std::string temp_path = fmt::format("{}.{:x}.tmp", path, Common::Timer::GetCurrentValue());
+	if (!FileSystem::WriteBinaryFile(temp_path.c_str(), data.data(), data.size()) ||
+		!FileSystem::RenamePath(temp_path.c_str(), path.c_str()))
+	{
+		Console.Warning(fmt::format("[GameDB] Failed to write binary database to '{}'.", path));
+		FileSystem::DeleteFilePath(temp_path.c_str());
+	}
+}
+
+const GameDatabaseSchema::GameEntry* GameDatabase::decodeBinaryEntry(const std::string& serial)
+{
+	if (!s_binary_db)
+		return nullptr;
+
+	GameDatabaseSchema::GameEntry entry;
+	if (!decodeBinaryDatabaseEntry(s_binary_db, s_binary_db_size, serial, &entry))
+		return nullptr;
+
+	return &s_game_db.emplace(serial, std::move(entry)).first->second;
+}
+
+void GameDatabase::initDatabase()
+{
+	const std::string yaml_path = Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME);
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(yaml_path.c_str(), &sd))
+	{
+		Console.Error("[GameDB] Unable to open GameDB file, file does not exist.");
+		return;
+	}
+
+	if (openBinaryDatabase(sd))
+		return;
+
+	parseYamlDatabase(yaml_path);
+	if (!s_game_db.empty())
+		writeBinaryDatabase(sd);
+}
+
 void GameDatabase::ensureLoaded()
 {
 	std::call_once(s_load_once_flag, []() {
 		Common::Timer timer;
 		Console.WriteLn(fmt::format("[GameDB] Has not been initialized yet, initializing..."));
 		initDatabase();
-		Console.WriteLn("[GameDB] %zu games on record (loaded in %.2fms)", s_game_db.size(), timer.GetTimeMilliseconds());
+		Console.WriteLn("[GameDB] %zu games on record (loaded in %.2fms)",
+			s_binary_db ? static_cast<size_t>(s_binary_db_header->num_entries) : s_game_db.size(), timer.GetTimeMilliseconds());
 	});
 }
 
@@ -998,8 +1454,12 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
-	auto iter = s_game_db.find(StringUtil::toLower(serial));
-	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+	const std::string serial_lower = StringUtil::toLower(serial);
+
+	// Entries are decoded from the binary database on first lookup, the map owns them from then on.
+	std::unique_lock lock(s_game_db_mutex);
+	auto iter = s_game_db.find(serial_lower);
+	return (iter != s_game_db.end()) ? &iter->second : decodeBinaryEntry(serial_lower);
 }
 
 bool GameDatabase::TrackHash::parseHash(const std::string_view str)
@@ -128,6 +128,15 @@ namespace GameDatabase
 	void ensureLoaded();
 	const GameDatabaseSchema::GameEntry* findGame(const std::string_view serial);
 
+	/// Compiled copy of GameIndex.yaml which is kept in the cache directory. The YAML's size and timestamp
+	/// are stored with it, and the copy is only valid while they still match. Entries can only be decoded from
+	/// data which isBinaryDatabaseValid() accepted.
+	std::vector<u8> serializeBinaryDatabase(
+		const std::unordered_map<std::string, GameDatabaseSchema::GameEntry>& db, u64 source_size, s64 source_timestamp);
+	bool isBinaryDatabaseValid(const u8* data, size_t size, u64 source_size, s64 source_timestamp);
+	bool decodeBinaryDatabaseEntry(
+		const u8* data, size_t size, const std::string_view serial, GameDatabaseSchema::GameEntry* entry);
+
 	struct TrackHash
 	{
 		static constexpr u32 SIZE = 16;
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <utility>
 
 //#define LOG_UNDERRUN(...) DEV_LOG(__VA_ARGS__)
 #define LOG_UNDERRUN(...) (void)0
@@ -255,6 +256,7 @@ void AudioStream::ReadFrames(SampleType* samples, u32 num_frames)
 		silence_frames = frames_to_read - available_frames;
 		frames_to_read = available_frames;
 		m_filling = true;
+		m_underrun_count.fetch_add(1, std::memory_order_relaxed);
 
 		if (IsStretchEnabled())
 			StretchUnderrun();
@@ -368,6 +370,7 @@ void AudioStream::InternalWriteFrames(const SampleType* data, u32 num_frames)
 	const u32 free = m_buffer_size - GetBufferedFramesRelaxed();
 	if (free <= num_frames)
 	{
+		m_overrun_count++;
 		if (IsStretchEnabled())
 		{
 			StretchOverrun();
@@ -434,6 +437,8 @@ void AudioStream::AllocateBuffer()
 		"Allocated buffer of {} frames for buffer of {} ms [expansion {} (block size {}), stretch {}, target size {}].",
 		m_buffer_size, m_parameters.buffer_ms, GetExpansionModeName(m_parameters.expansion_mode),
 		m_parameters.expand_block_size, m_stretch_enabled ? "enabled" : "disabled", m_target_buffer_size);
+
+	StatsReset();
 }
 
 void AudioStream::DestroyBuffer()
@@ -633,10 +638,8 @@ void AudioStream::WriteChunk(const SampleType* chunk)
 	if (!IsExpansionEnabled() && !IsStretchEnabled())
 	{
 		InternalWriteFrames(chunk, CHUNK_SIZE);
-		return;
 	}
-
-	if (IsExpansionEnabled())
+	else if (IsExpansionEnabled())
 	{
 		// StretchWriteBlock() overwrites the staging buffer on output, so we need to copy into the expand buffer first.
 		S16ChunkToFloat(chunk, m_expand_buffer.get() + m_expand_buffer_pos * NUM_INPUT_CHANNELS, CHUNK_SIZE * NUM_INPUT_CHANNELS);
@@ -658,6 +661,8 @@ void AudioStream::WriteChunk(const SampleType* chunk)
 		S16ChunkToFloat(chunk, m_float_buffer.get(), CHUNK_SIZE * NUM_INPUT_CHANNELS);
 		StretchWriteBlock(m_float_buffer.get());
 	}
+
+	StatsUpdate();
 }
 
 template <class T>
@@ -690,6 +695,7 @@ void AudioStream::StretchAllocate()
 	m_dynamic_target_usage = 0.0f;
 	m_average_position = 0;
 	m_average_available = 0;
+	m_stretch_bypassed = false;
 
 	m_staging_buffer_pos = 0;
 }
@@ -703,13 +709,29 @@ void AudioStream::StretchWriteBlock(const float* block)
 {
 	if (IsStretchEnabled())
 	{
-		m_soundtouch->putSamples(block, CHUNK_SIZE);
+		if (ShouldBypassStretch())
+		{
+			if (!m_stretch_bypassed)
+				StretchBypassFlush();
 
-		u32 tempProgress;
-		while (tempProgress = m_soundtouch->receiveSamples(m_float_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+			FloatChunkToS16(m_staging_buffer.get(), block, CHUNK_SIZE * m_internal_channels);
+			InternalWriteFrames(m_staging_buffer.get(), CHUNK_SIZE);
+		}
+		else
 		{
-			FloatChunkToS16(m_staging_buffer.get(), m_float_buffer.get(), tempProgress * m_internal_channels);
-			InternalWriteFrames(m_staging_buffer.get(), tempProgress);
+			m_stretch_bypassed = false;
+
+			const u64 start_time = Common::Timer::GetCurrentValue();
+			m_soundtouch->putSamples(block, CHUNK_SIZE);
+
+			u32 tempProgress;
+			while (tempProgress = m_soundtouch->receiveSamples(m_float_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+			{
+				FloatChunkToS16(m_staging_buffer.get(), m_float_buffer.get(), tempProgress * m_internal_channels);
+				InternalWriteFrames(m_staging_buffer.get(), tempProgress);
+			}
+
+			m_stats_stretch_time += Common::Timer::GetCurrentValue() - start_time;
 		}
 
 		if (IsStretchEnabled())
@@ -722,6 +744,28 @@ void AudioStream::StretchWriteBlock(const float* block)
 	}
 }
 
+bool AudioStream::ShouldBypassStretch() const
+{
+	// Once the stretcher has settled at 1:1 there's nothing for SoundTouch to do, other than add latency.
+	return (m_parameters.stretch_low_latency && m_stretch_inactive && m_nominal_rate == 1.0f);
+}
+
+void AudioStream::StretchBypassFlush()
+{
+	// Pass through whatever SoundTouch has already processed. Input still in its window is dropped, which is at most
+	// one sequence, and only happens once when the stream settles.
+	u32 tempProgress;
+	while (tempProgress = m_soundtouch->receiveSamples(m_float_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+	{
+		FloatChunkToS16(m_staging_buffer.get(), m_float_buffer.get(), tempProgress * m_internal_channels);
+		InternalWriteFrames(m_staging_buffer.get(), tempProgress);
+	}
+
+	m_soundtouch->clear();
+	m_stretch_bypassed = true;
+	LOG_UNDERRUN("--- Stretcher bypassed.");
+}
+
 float AudioStream::AddAndGetAverageTempo(float val)
 {
 	if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
@@ -852,6 +896,109 @@ void AudioStream::StretchOverrun()
 	m_rpos.store((m_rpos.load(std::memory_order_acquire) + discard) % m_buffer_size, std::memory_order_release);
 }
 
+bool AudioStream::ConsumeStatsUpdate()
+{
+	return std::exchange(m_stats_updated, false);
+}
+
+void AudioStream::StatsReset()
+{
+	m_underrun_count.store(0, std::memory_order_relaxed);
+	m_overrun_count = 0;
+	m_stats_chunks = 0;
+	m_stats_last_underruns = 0;
+	m_adaptive_hold = 0;
+	m_stats_fill_sum = 0.0;
+	m_stats_fill_sq_sum = 0.0;
+	m_stats_window_start = Common::Timer::GetCurrentValue();
+	m_stats_stretch_time = 0;
+	m_stats_updated = false;
+
+	m_stats = {};
+	m_stats.target_latency_ms = static_cast<float>(GetMSForBufferSize(m_sample_rate, m_target_buffer_size));
+}
+
+void AudioStream::StatsUpdate()
+{
+	const double fill = static_cast<double>(GetBufferedFramesRelaxed());
+	m_stats_fill_sum += fill;
+	m_stats_fill_sq_sum += fill * fill;
+	if (++m_stats_chunks < STATS_WINDOW)
+		return;
+
+	const u64 now = Common::Timer::GetCurrentValue();
+	const double window_time = Common::Timer::ConvertValueToSeconds(now - m_stats_window_start);
+	const double mean = m_stats_fill_sum / static_cast<double>(STATS_WINDOW);
+	const double deviation = std::sqrt(std::max(m_stats_fill_sq_sum / static_cast<double>(STATS_WINDOW) - mean * mean, 0.0));
+	const u32 underruns = m_underrun_count.load(std::memory_order_relaxed);
+
+	if (IsStretchEnabled() && m_parameters.stretch_adaptive_latency)
+		UpdateAdaptiveTarget(static_cast<float>(deviation), underruns - m_stats_last_underruns);
+
+	const float frames_to_ms = 1000.0f / static_cast<float>(m_sample_rate);
+	m_stats.underruns = underruns;
+	m_stats.overruns = m_overrun_count;
+	m_stats.average_fill_ms = static_cast<float>(mean) * frames_to_ms;
+	m_stats.fill_deviation_ms = static_cast<float>(deviation) * frames_to_ms;
+	m_stats.target_latency_ms = static_cast<float>(m_target_buffer_size) * frames_to_ms;
+	m_stats.stretch_usage = (window_time > 0.0) ?
+								static_cast<float>(100.0 * Common::Timer::ConvertValueToSeconds(m_stats_stretch_time) / window_time) :
+								0.0f;
+	m_stats.stretch_bypassed = m_stretch_bypassed;
+	m_stats_updated = true;
+
+	m_stats_chunks = 0;
+	m_stats_last_underruns = underruns;
+	m_stats_fill_sum = 0.0;
+	m_stats_fill_sq_sum = 0.0;
+	m_stats_window_start = now;
+	m_stats_stretch_time = 0;
+}
+
+void AudioStream::UpdateAdaptiveTarget(float fill_deviation, u32 underruns)
+{
+	// Headroom above an empty buffer, in standard deviations of the fill level. The spread mostly comes from the
+	// host pulling in callback-sized bursts, plus jitter in how quickly the emulator produces samples.
+	static constexpr float DEVIATION_HEADROOM = 4.0f;
+
+	// How many windows to hold the target after an underrun, before trying to lower it again.
+	static constexpr u32 UNDERRUN_HOLD_WINDOWS = 16;
+
+	// The configured buffer size is the upper limit, we only ever go lower than it.
+	const u32 max_target = GetBufferSizeForMS(m_sample_rate, m_parameters.buffer_ms);
+	const u32 min_target = std::min(CHUNK_SIZE * 4, max_target);
+	const u32 wanted = static_cast<u32>(fill_deviation * DEVIATION_HEADROOM) + CHUNK_SIZE * 2;
+
+	u32 target = m_target_buffer_size;
+	if (underruns > 0)
+	{
+		// Back off quickly.
+		target = GetAlignedBufferSize(std::max(target + target / 4, wanted));
+		m_adaptive_hold = UNDERRUN_HOLD_WINDOWS;
+	}
+	else if (wanted > target)
+	{
+		target = GetAlignedBufferSize(wanted);
+	}
+	else if (m_adaptive_hold > 0)
+	{
+		m_adaptive_hold--;
+	}
+	else
+	{
+		// Creep down, so the stretcher has time to follow.
+		target = Common::AlignDownPow2(target - std::min(target - wanted, target / 16), CHUNK_SIZE);
+	}
+
+	target = std::clamp(target, min_target, max_target);
+	if (target == m_target_buffer_size)
+		return;
+
+	DEBUG_LOG("Adaptive audio target {} -> {} frames ({} underruns, fill deviation {:.1f} frames)",
+		m_target_buffer_size, target, underruns, fill_deviation);
+	m_target_buffer_size = target;
+}
+
 void AudioStreamParameters::LoadSave(SettingsWrapper& wrap, const char* section)
 {
 	wrap.EnumEntry(section, "ExpansionMode", expansion_mode, &AudioStream::ParseExpansionMode, &AudioStream::GetExpansionModeName, DEFAULT_EXPANSION_MODE);
@@ -864,6 +1011,8 @@ void AudioStreamParameters::LoadSave(SettingsWrapper& wrap, const char* section)
 	stretch_overlap_ms = static_cast<u16>(std::clamp<int>(wrap.EntryBitfield(section, "StretchOverlapMS", DEFAULT_STRETCH_OVERLAP), 0, std::numeric_limits<u16>::max()));
 	stretch_use_quickseek = wrap.EntryBitBool(section, "StretchUseQuickSeek", DEFAULT_STRETCH_USE_QUICKSEEK);
 	stretch_use_aa_filter = wrap.EntryBitBool(section, "StretchUseAAFilter", DEFAULT_STRETCH_USE_AA_FILTER);
+	stretch_adaptive_latency = wrap.EntryBitBool(section, "StretchAdaptiveLatency", DEFAULT_STRETCH_ADAPTIVE_LATENCY);
+	stretch_low_latency = wrap.EntryBitBool(section, "StretchLowLatency", DEFAULT_STRETCH_LOW_LATENCY);
 
 	expand_block_size = static_cast<u16>(std::clamp<int>(wrap.EntryBitfield(section, "ExpandBlockSize", DEFAULT_EXPAND_BLOCK_SIZE), 0, std::numeric_limits<u16>::max()));
 	wrap.Entry(section, "ExpandCircularWrap", expand_circular_wrap, DEFAULT_EXPAND_CIRCULAR_WRAP);
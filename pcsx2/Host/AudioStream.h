@@ -68,6 +68,7 @@ public:
 	__fi bool IsExpansionEnabled() const { return m_parameters.expansion_mode != AudioExpansionMode::Disabled; }
 	__fi bool IsStretchEnabled() const { return m_stretch_enabled; }
 	__fi bool IsPaused() const { return m_paused; }
+	__fi const AudioStreamStats& GetStats() const { return m_stats; }
 
 	u32 GetBufferedFramesRelaxed() const;
 
@@ -90,6 +91,10 @@ public:
 
 	void SetStretchEnabled(bool enabled);
 
+	/// Returns true once for each statistics window that has completed since the last call.
+	/// Must be called from the thread writing to the stream.
+	bool ConsumeStatsUpdate();
+
 	static std::vector<std::pair<std::string, std::string>> GetDriverNames(AudioBackend backend);
 	static std::vector<DeviceInfo> GetOutputDevices(AudioBackend backend, const char* driver);
 	static std::unique_ptr<AudioStream> CreateStream(AudioBackend backend, u32 sample_rate, const AudioStreamParameters& parameters,
@@ -139,6 +144,9 @@ private:
 	static constexpr u32 STRETCH_RESET_THRESHOLD = 5;
 	static constexpr u32 TARGET_IPS = 691;
 
+	// Statistics and the adaptive target are updated every STATS_WINDOW chunks, roughly every 340ms at 48KHz.
+	static constexpr u32 STATS_WINDOW = 256;
+
 	static std::vector<std::pair<std::string, std::string>> GetCubebDriverNames();
 	static std::vector<DeviceInfo> GetCubebOutputDevices(const char* driver);
 	static std::unique_ptr<AudioStream> CreateCubebAudioStream(u32 sample_rate, const AudioStreamParameters& parameters,
@@ -162,6 +170,12 @@ private:
 
 	float AddAndGetAverageTempo(float val);
 	void UpdateStretchTempo();
+	bool ShouldBypassStretch() const;
+	void StretchBypassFlush();
+
+	void StatsReset();
+	void StatsUpdate();
+	void UpdateAdaptiveTarget(float fill_deviation, u32 underruns);
 
 	u32 m_buffer_size = 0;
 	std::unique_ptr<s16[]> m_buffer;
@@ -185,6 +199,20 @@ private:
 
 	std::array<float, AVERAGING_BUFFER_SIZE> m_average_fullness = {};
 
+	// underruns are counted on the reader thread, everything else is owned by the writer
+	std::atomic<u32> m_underrun_count{0};
+	u32 m_overrun_count = 0;
+	u32 m_stats_chunks = 0;
+	u32 m_stats_last_underruns = 0;
+	u32 m_adaptive_hold = 0;
+	double m_stats_fill_sum = 0.0;
+	double m_stats_fill_sq_sum = 0.0;
+	u64 m_stats_window_start = 0;
+	u64 m_stats_stretch_time = 0;
+	bool m_stats_updated = false;
+	bool m_stretch_bypassed = false;
+	AudioStreamStats m_stats;
+
 	// temporary staging buffer, used for timestretching
 	std::unique_ptr<s16[]> m_staging_buffer;
 
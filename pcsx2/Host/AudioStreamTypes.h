@@ -38,6 +38,8 @@ struct AudioStreamParameters
 	u16 stretch_overlap_ms = DEFAULT_STRETCH_OVERLAP;
 	bool stretch_use_quickseek = DEFAULT_STRETCH_USE_QUICKSEEK;
 	bool stretch_use_aa_filter = DEFAULT_STRETCH_USE_AA_FILTER;
+	bool stretch_adaptive_latency = DEFAULT_STRETCH_ADAPTIVE_LATENCY;
+	bool stretch_low_latency = DEFAULT_STRETCH_LOW_LATENCY;
 
 	float expand_circular_wrap = DEFAULT_EXPAND_CIRCULAR_WRAP;
 	float expand_shift = DEFAULT_EXPAND_SHIFT;
@@ -72,9 +74,22 @@ struct AudioStreamParameters
 
 	static constexpr bool DEFAULT_STRETCH_USE_QUICKSEEK = false;
 	static constexpr bool DEFAULT_STRETCH_USE_AA_FILTER = false;
+	static constexpr bool DEFAULT_STRETCH_ADAPTIVE_LATENCY = false;
+	static constexpr bool DEFAULT_STRETCH_LOW_LATENCY = false;
 
 	void LoadSave(SettingsWrapper& wrap, const char* section);
 
 	bool operator==(const AudioStreamParameters& rhs) const;
 	bool operator!=(const AudioStreamParameters& rhs) const;
 };
+
+struct AudioStreamStats
+{
+	u32 underruns = 0;
+	u32 overruns = 0;
+	float average_fill_ms = 0.0f;
+	float fill_deviation_ms = 0.0f;
+	float target_latency_ms = 0.0f;
+	float stretch_usage = 0.0f;
+	bool stretch_bypassed = false;
+};
@@ -157,6 +157,11 @@ DEFINE_HOTKEY("ToggleSlowMotion", TRANSLATE_NOOP("Hotkeys", "System"), TRANSLATE
 				(VMManager::GetLimiterMode() != LimiterModeType::Slomo) ? LimiterModeType::Slomo : LimiterModeType::Nominal);
 		}
 	})
+DEFINE_HOTKEY("ToggleJITProfiler", TRANSLATE_NOOP("Hotkeys", "System"), TRANSLATE_NOOP("Hotkeys", "Toggle JIT Profiler"),
+	[](s32 pressed) {
+		if (!pressed && VMManager::HasValidVM())
+			VMManager::SetJITProfilerActive(!VMManager::IsJITProfilerActive());
+	})
 DEFINE_HOTKEY("HoldTurbo", TRANSLATE_NOOP("Hotkeys", "System"),
 	TRANSLATE_NOOP("Hotkeys", "Turbo / Fast Forward (Hold)"), [](s32 pressed) {
 		if (!VMManager::HasValidVM())
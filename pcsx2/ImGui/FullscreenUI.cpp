@@ -3980,6 +3980,12 @@ void FullscreenUI::DrawAudioSettingsPage()
 		"SPU2/Output", "SyncMode", Pcsx2Config::SPU2Options::DEFAULT_SYNC_MODE,
 		&Pcsx2Config::SPU2Options::ParseSyncMode, &Pcsx2Config::SPU2Options::GetSyncModeName,
 		&Pcsx2Config::SPU2Options::GetSyncModeDisplayName, Pcsx2Config::SPU2Options::SPU2SyncMode::Count);
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_RULER, "Adaptive Latency"),
+		FSUI_CSTR("Lowers the time stretch buffer target as far as the measured buffer fill allows, using the buffer size as the upper limit."),
+		"SPU2/Output", "StretchAdaptiveLatency", AudioStreamParameters::DEFAULT_STRETCH_ADAPTIVE_LATENCY);
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_STOPWATCH, "Bypass Stretching at 100% Speed"),
+		FSUI_CSTR("Skips the time stretcher once emulation is running at full speed, removing its processing latency."),
+		"SPU2/Output", "StretchLowLatency", AudioStreamParameters::DEFAULT_STRETCH_LOW_LATENCY);
 	DrawIntRangeSetting(bsi, FSUI_ICONSTR(ICON_FA_RULER, "Buffer Size"),
 		FSUI_CSTR("Determines the amount of audio buffered before being pulled by the host API."),
 		"SPU2/Output", "BufferMS", AudioStreamParameters::DEFAULT_BUFFER_MS, 10, 500, FSUI_CSTR("%d ms"));
@@ -4755,6 +4761,9 @@ void FullscreenUI::DrawAdvancedSettingsPage()
 		DrawToggleSetting(bsi, FSUI_CSTR("Enable Fast Memory Access"),
 			FSUI_CSTR("Uses backpatching to avoid register flushing on every memory access."), "EmuCore/CPU/Recompiler", "EnableFastmem",
 			true);
+		DrawToggleSetting(bsi, FSUI_CSTR("Enable Hot Trace Superblocks"),
+			FSUI_CSTR("Recompiles frequently executed blocks past their conditional branches. Experimental."), "EmuCore/CPU/Recompiler",
+			"EnableEESuperblocks", false);
 
 		MenuHeading(FSUI_CSTR("Vector Units"));
 		DrawIntListSetting(bsi, FSUI_CSTR("VU0 Rounding Mode"),
@@ -4916,6 +4925,9 @@ void FullscreenUI::DrawGameFixesSettingsPage()
 		FSUI_CSTR("Simulate VIF1 FIFO read ahead. Known to affect following games: Test Drive Unlimited, Transformers."), "EmuCore/Gamefixes", "VIFFIFOHack", false);
 	DrawToggleSetting(bsi, FSUI_CSTR("Full VU0 Synchronization"), FSUI_CSTR("Forces tight VU0 sync on every COP2 instruction."),
 		"EmuCore/Gamefixes", "FullVU0SyncHack", false);
+	DrawToggleSetting(bsi, FSUI_CSTR("Emulate EE Data Cache"),
+		FSUI_CSTR("Emulates the EE data cache in both the interpreter and the recompiler. Slower, but needed by games which rely on cache behavior."),
+		"EmuCore/Gamefixes", "EECacheHack", false);
 	DrawToggleSetting(bsi, FSUI_CSTR("VU I Bit Hack"),
 		FSUI_CSTR("Avoids constant recompilation in some games. Known to affect the following games: Scarface The World is Yours, Crash Tag Team Racing."), "EmuCore/Gamefixes", "IbitHack", false);
 	DrawToggleSetting(bsi, FSUI_CSTR("VU Add Hack"),
@@ -7208,6 +7220,8 @@ TRANSLATE_NOOP("FullscreenUI", "Enable Wait Loop Detection");
 TRANSLATE_NOOP("FullscreenUI", "Moderate speedup for some games, with no known side effects.");
 TRANSLATE_NOOP("FullscreenUI", "Enable Fast Memory Access");
 TRANSLATE_NOOP("FullscreenUI", "Uses backpatching to avoid register flushing on every memory access.");
+TRANSLATE_NOOP("FullscreenUI", "Enable Hot Trace Superblocks");
+TRANSLATE_NOOP("FullscreenUI", "Recompiles frequently executed blocks past their conditional branches. Experimental.");
 TRANSLATE_NOOP("FullscreenUI", "Vector Units");
 TRANSLATE_NOOP("FullscreenUI", "VU0 Rounding Mode");
 TRANSLATE_NOOP("FullscreenUI", "VU0 Clamping Mode");
@@ -7259,6 +7273,8 @@ TRANSLATE_NOOP("FullscreenUI", "Emulate VIF FIFO");
 TRANSLATE_NOOP("FullscreenUI", "Simulate VIF1 FIFO read ahead. Known to affect following games: Test Drive Unlimited, Transformers.");
 TRANSLATE_NOOP("FullscreenUI", "Full VU0 Synchronization");
 TRANSLATE_NOOP("FullscreenUI", "Forces tight VU0 sync on every COP2 instruction.");
+TRANSLATE_NOOP("FullscreenUI", "Emulate EE Data Cache");
+TRANSLATE_NOOP("FullscreenUI", "Emulates the EE data cache in both the interpreter and the recompiler. Slower, but needed by games which rely on cache behavior.");
 TRANSLATE_NOOP("FullscreenUI", "VU I Bit Hack");
 TRANSLATE_NOOP("FullscreenUI", "Avoids constant recompilation in some games. Known to affect the following games: Scarface The World is Yours, Crash Tag Team Racing.");
 TRANSLATE_NOOP("FullscreenUI", "VU Add Hack");
@@ -22,6 +22,7 @@
 #include "Recording/InputRecording.h"
 #include "SIO/Pad/Pad.h"
 #include "SIO/Pad/PadBase.h"
+#include "SaveState.h"
 #include "USB/USB.h"
 #include "VMManager.h"
 #include "svnrev.h"
@@ -30,7 +31,9 @@
 #include "common/BitUtils.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
+#include "common/Perf.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "common/Timer.h"
 
 #include "fmt/chrono.h"
@@ -40,6 +43,7 @@
 #include <array>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <deque>
 #include <limits>
 #include <mutex>
@@ -55,6 +59,7 @@ namespace ImGuiManager
 	static void DrawInputsOverlay(float scale, float margin, float spacing);
 	static void DrawInputRecordingOverlay(float& position_y, float scale, float margin, float spacing);
 	static void DrawVideoCaptureOverlay(float& position_y, float scale, float margin, float spacing);
+	static void DrawJITProfilerOverlay(float& position_y, float scale, float margin, float spacing);
 } // namespace ImGuiManager
 
 static std::tuple<float, float> GetMinMax(std::span<const float> values)
@@ -231,6 +236,9 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 			FormatProcessorStat(text, PerformanceMetrics::GetCPUThreadUsage(), PerformanceMetrics::GetCPUThreadAverageTime());
 			DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
+			text.format("IOP: {:.2f} MHz", PerformanceMetrics::GetIOPCyclesPerSecond() / 1000000.0);
+			DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+
 			text = "GS: ";
 			FormatProcessorStat(text, PerformanceMetrics::GetGSThreadUsage(), PerformanceMetrics::GetGSThreadAverageTime());
 			DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
@@ -257,6 +265,18 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 				FormatProcessorStat(text, PerformanceMetrics::GetCaptureThreadUsage(), PerformanceMetrics::GetCaptureThreadAverageTime());
 				DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
+
+			const AudioStreamStats& audio = PerformanceMetrics::GetAudioStreamStats();
+			text.format("SPU2: {:.1f}/{:.0f}ms Dev: {:.1f}ms UR: {}", audio.average_fill_ms, audio.target_latency_ms,
+				audio.fill_deviation_ms, audio.underruns);
+			if (EmuConfig.SPU2.IsTimeStretchEnabled())
+			{
+				if (audio.stretch_bypassed)
+					text.append(" TS: Bypass");
+				else
+					text.append_format(" TS: {:.1f}%", audio.stretch_usage);
+			}
+			DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 		}
 
 		if (GSConfig.OsdShowGPU)
@@ -715,6 +735,65 @@ __ri void ImGuiManager::DrawVideoCaptureOverlay(float& position_y, float scale,
 	position_y += std::max(icon_size.y, text_size.y) + spacing;
 }
 
+__ri void ImGuiManager::DrawJITProfilerOverlay(float& position_y, float scale, float margin, float spacing)
+{
+	static constexpr size_t NUM_ENTRIES = 10;
+
+	if (!Perf::Sampler::IsActive() || FullscreenUI::HasActiveWindow())
+		return;
+
+	const float shadow_offset = std::ceil(scale);
+
+	ImFont* const fixed_font = ImGuiManager::GetFixedFont();
+	ImFont* const standard_font = ImGuiManager::GetStandardFont();
+
+	ImDrawList* dl = ImGui::GetBackgroundDrawList();
+	ImVec2 text_size;
+
+#define DRAW_LINE(font, text, color) \
+	do \
+	{ \
+		text_size = font->CalcTextSizeA(font->FontSize, std::numeric_limits<float>::max(), -1.0f, (text), nullptr, nullptr); \
+		dl->AddText(font, font->FontSize, \
+			ImVec2(GetWindowWidth() - margin - text_size.x + shadow_offset, position_y + shadow_offset), \
+			IM_COL32(0, 0, 0, 100), (text)); \
+		dl->AddText(font, font->FontSize, ImVec2(GetWindowWidth() - margin - text_size.x, position_y), color, (text)); \
+		position_y += text_size.y + spacing; \
+	} while (0)
+
+	const Perf::Sampler::Report report = Perf::Sampler::GetReport(NUM_ENTRIES);
+	DRAW_LINE(standard_font,
+		TinyString::from_format(TRANSLATE_FS("ImGuiOverlays", "{} JIT Profiler: {} samples"), ICON_FA_STOPWATCH,
+			report.total_samples)
+			.c_str(),
+		IM_COL32(255, 255, 255, 255));
+
+	// Time in the block itself, then time in native code (memory handlers, event tests, etc) called from it.
+	if (report.total_samples > 0)
+	{
+		const double scale_pct = 100.0 / static_cast<double>(report.total_samples);
+		for (const Perf::Sampler::Entry& entry : report.entries)
+		{
+			DRAW_LINE(fixed_font,
+				SmallString::from_format("{} {:5.1f}% {:5.1f}%", entry.symbol,
+					static_cast<double>(entry.samples) * scale_pct, static_cast<double>(entry.native_samples) * scale_pct)
+					.c_str(),
+				IM_COL32(117, 255, 241, 255));
+		}
+
+		if (report.unknown_samples > 0)
+		{
+			DRAW_LINE(fixed_font,
+				SmallString::from_format(TRANSLATE_FS("ImGuiOverlays", "Unattributed: {:5.1f}%"),
+					static_cast<double>(report.unknown_samples) * scale_pct)
+					.c_str(),
+				IM_COL32(255, 255, 255, 255));
+		}
+	}
+
+#undef DRAW_LINE
+}
+
 namespace SaveStateSelectorUI
 {
 	namespace
@@ -729,7 +808,11 @@ namespace SaveStateSelectorUI
 	} // namespace
 
 	static void InitializePlaceholderListEntry(ListEntry* li, std::string path, s32 slot);
-	static void InitializeListEntry(const std::string& serial, u32 crc, ListEntry* li, s32 slot);
+	static void InitializeListEntry(ListEntry* li, s32 slot, const SaveStateFileInfo& info);
+	static void ProcessLoadedEntries();
+	static void CancelPendingLookups();
+	static void StopLoaderThread();
+	static void LoaderThread();
 
 	static void RefreshHotkeyLegend();
 	static void Draw();
@@ -746,6 +829,29 @@ namespace SaveStateSelectorUI
 	static std::array<ListEntry, VMManager::NUM_SAVE_STATE_SLOTS> s_slots;
 	static std::atomic_int32_t s_current_slot{0};
 
+	// Slots are looked up on their own thread, since the states can be on slow storage.
+	// Results are picked up by Draw(), and dropped if the list has been refreshed since.
+	struct PendingLookup
+	{
+		u32 generation;
+		s32 slot;
+		std::string path;
+	};
+	struct LoadedEntry
+	{
+		u32 generation;
+		s32 slot;
+		bool exists;
+		SaveStateFileInfo info;
+	};
+	static std::atomic_bool s_loader_thread_quit{false};
+	static std::mutex s_loader_mutex;
+	static std::condition_variable s_loader_cv;
+	static std::deque<PendingLookup> s_pending_lookups;
+	static std::vector<LoadedEntry> s_loaded_entries;
+	static Threading::Thread s_loader_thread;
+	static u32 s_list_generation = 0;
+
 	static float s_open_time = 0.0f;
 	static float s_close_time = 0.0f;
 
@@ -793,18 +899,115 @@ void SaveStateSelectorUI::Close()
 
 void SaveStateSelectorUI::RefreshList(const std::string& serial, u32 crc)
 {
-	for (ListEntry& entry : s_slots)
+	if (!s_loader_thread.Joinable())
 	{
-		if (entry.preview_texture)
-			g_gs_device->Recycle(entry.preview_texture.release());
+		s_loader_thread_quit.store(false, std::memory_order_release);
+		s_loader_thread.Start(LoaderThread);
 	}
 
+	const u32 generation = ++s_list_generation;
+	std::deque<PendingLookup> lookups;
 	for (u32 i = 0; i < VMManager::NUM_SAVE_STATE_SLOTS; i++)
-		InitializeListEntry(serial, crc, &s_slots[i], static_cast<s32>(i + 1));
+	{
+		ListEntry& li = s_slots[i];
+		if (li.preview_texture)
+			g_gs_device->Recycle(li.preview_texture.release());
+
+		const s32 slot = static_cast<s32>(i + 1);
+		std::string path = VMManager::GetSaveStateFileName(serial.c_str(), crc, slot);
+		li.title = fmt::format(TRANSLATE_FS("ImGuiOverlays", "Save Slot {0}"), slot);
+		li.summary = {};
+		li.filename = Path::GetFileName(path);
+
+		lookups.push_back(PendingLookup{generation, slot, std::move(path)});
+	}
+
+	std::unique_lock lock(s_loader_mutex);
+	s_pending_lookups = std::move(lookups);
+	s_loader_cv.notify_one();
+}
+
+void SaveStateSelectorUI::CancelPendingLookups()
+{
+	std::unique_lock lock(s_loader_mutex);
+	s_pending_lookups.clear();
+}
+
+void SaveStateSelectorUI::StopLoaderThread()
+{
+	if (!s_loader_thread.Joinable())
+		return;
+
+	{
+		std::unique_lock lock(s_loader_mutex);
+		s_loader_thread_quit.store(true, std::memory_order_release);
+		s_loader_cv.notify_one();
+	}
+	s_loader_thread.Join();
+
+	s_pending_lookups.clear();
+	s_loaded_entries.clear();
+}
+
+void SaveStateSelectorUI::LoaderThread()
+{
+	Threading::SetNameOfCurrentThread("Save State Selector Loader");
+
+	std::unique_lock lock(s_loader_mutex);
+
+	for (;;)
+	{
+		s_loader_cv.wait(
+			lock, []() { return (s_loader_thread_quit.load(std::memory_order_acquire) || !s_pending_lookups.empty()); });
+
+		if (s_loader_thread_quit.load(std::memory_order_acquire))
+			break;
+
+		while (!s_pending_lookups.empty())
+		{
+			PendingLookup lookup(std::move(s_pending_lookups.front()));
+			s_pending_lookups.pop_front();
+
+			lock.unlock();
+			LoadedEntry entry{lookup.generation, lookup.slot};
+			entry.exists = SaveState_GetFileInfo(lookup.path, &entry.info);
+			lock.lock();
+
+			s_loaded_entries.push_back(std::move(entry));
+		}
+	}
+}
+
+void SaveStateSelectorUI::ProcessLoadedEntries()
+{
+	std::vector<LoadedEntry> entries;
+	{
+		std::unique_lock lock(s_loader_mutex);
+		if (s_loaded_entries.empty())
+			return;
+
+		entries = std::move(s_loaded_entries);
+		s_loaded_entries.clear();
+	}
+
+	for (const LoadedEntry& entry : entries)
+	{
+		if (entry.generation != s_list_generation)
+			continue;
+
+		ListEntry* li = &s_slots[entry.slot - 1];
+		if (entry.exists)
+			InitializeListEntry(li, entry.slot, entry.info);
+		else
+			InitializePlaceholderListEntry(li, std::move(li->filename), entry.slot);
+	}
 }
 
 void SaveStateSelectorUI::Clear()
 {
+	StopLoaderThread();
+	SaveState_ClearIndex();
+
 	// called on CPU thread at shutdown, textures should already be deleted, unless running
 	// big picture UI, in which case we have to delete them here...
 	for (ListEntry& li : s_slots)
@@ -826,6 +1029,10 @@ void SaveStateSelectorUI::DestroyTextures()
 {
 	Close();
 
+	// Anything still loading is for textures we're about to throw away.
+	CancelPendingLookups();
+	s_list_generation++;
+
 	for (ListEntry& entry : s_slots)
 	{
 		if (entry.preview_texture)
@@ -892,28 +1099,21 @@ void SaveStateSelectorUI::SelectPreviousSlot(bool open_selector)
 	}
 }
 
-void SaveStateSelectorUI::InitializeListEntry(const std::string& serial, u32 crc, ListEntry* li, s32 slot)
+void SaveStateSelectorUI::InitializeListEntry(ListEntry* li, s32 slot, const SaveStateFileInfo& info)
 {
-	std::string path = VMManager::GetSaveStateFileName(serial.c_str(), crc, slot);
-	FILESYSTEM_STAT_DATA sd;
-	if (!FileSystem::StatFile(path.c_str(), &sd))
-	{
-		InitializePlaceholderListEntry(li, std::move(path), slot);
-		return;
-	}
-
 	li->title = fmt::format(TRANSLATE_FS("ImGuiOverlays", "Save Slot {0}"), slot);
-	li->summary = fmt::format(TRANSLATE_FS("ImGuiOverlays", DATE_TIME_FORMAT), fmt::localtime(sd.ModificationTime));
-	li->filename = Path::GetFileName(path);
+	li->summary = fmt::format(TRANSLATE_FS("ImGuiOverlays", DATE_TIME_FORMAT),
+		fmt::localtime(static_cast<std::time_t>(info.modification_time)));
+
+	if (li->preview_texture)
+		g_gs_device->Recycle(li->preview_texture.release());
 
-	u32 screenshot_width, screenshot_height;
-	std::vector<u32> screenshot_pixels;
-	if (SaveState_ReadScreenshot(path, &screenshot_width, &screenshot_height, &screenshot_pixels))
+	if (const SaveStateScreenshotData* screenshot = info.screenshot.get())
 	{
 		li->preview_texture =
-			std::unique_ptr<GSTexture>(g_gs_device->CreateTexture(screenshot_width, screenshot_height, 1, GSTexture::Format::Color));
-		if (!li->preview_texture || !li->preview_texture->Update(GSVector4i(0, 0, screenshot_width, screenshot_height),
-										screenshot_pixels.data(), sizeof(u32) * screenshot_width))
+			std::unique_ptr<GSTexture>(g_gs_device->CreateTexture(screenshot->width, screenshot->height, 1, GSTexture::Format::Color));
+		if (!li->preview_texture || !li->preview_texture->Update(GSVector4i(0, 0, screenshot->width, screenshot->height),
+										screenshot->pixels.data(), sizeof(u32) * screenshot->width))
 		{
 			Console.Error("Failed to upload save state image to GPU");
 			if (li->preview_texture)
@@ -934,6 +1134,8 @@ void SaveStateSelectorUI::Draw()
 	static constexpr float SCROLL_ANIMATION_TIME = 0.25f;
 	static constexpr float BG_ANIMATION_TIME = 0.15f;
 
+	ProcessLoadedEntries();
+
 	const auto& io = ImGui::GetIO();
 	const float scale = ImGuiManager::GetGlobalScale();
 	const float width = (600.0f * scale);
@@ -1110,6 +1312,7 @@ void ImGuiManager::RenderOverlays()
 	float position_y = margin;
 	DrawVideoCaptureOverlay(position_y, scale, margin, spacing);
 	DrawInputRecordingOverlay(position_y, scale, margin, spacing);
+	DrawJITProfilerOverlay(position_y, scale, margin, spacing);
 	if (GSConfig.OsdPerformancePos != OsdOverlayPos::None)
 		DrawPerformanceOverlay(position_y, scale, margin, spacing);
 	DrawSettingsOverlay(scale, margin, spacing);
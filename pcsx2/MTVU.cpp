@@ -161,8 +161,16 @@ void VU_Thread::ExecuteRingBuffer()
 				{
 					u32 vu_micro_addr = Read();
 					u32 size = Read();
-					CpuVU1->Clear(vu_micro_addr, size);
-					Read(&VU1.Micro[vu_micro_addr], size);
+					// Same as the VIF path, don't throw away the program search for an identical upload.
+					if (std::memcmp(&VU1.Micro[vu_micro_addr], &buffer[m_read_pos], size) != 0)
+					{
+						CpuVU1->Clear(vu_micro_addr, size);
+						Read(&VU1.Micro[vu_micro_addr], size);
+					}
+					else
+					{
+						m_read_pos += size_u32(size);
+					}
 					break;
 				}
 				case MTVU_VU_WRITE_DATA:
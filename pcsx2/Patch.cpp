@@ -23,10 +23,12 @@
 #include "fmt/format.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <memory>
 #include <span>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 namespace Patch
@@ -127,6 +129,26 @@ namespace Patch
 	using ActivePatchList = std::vector<const PatchCommand*>;
 	using EnablePatchList = std::vector<std::string>;
 
+	// Active patches are compiled per place into runs of constant writes to consecutive addresses.
+	// Most patches are already in memory by the next vsync, so a single compare per run is enough,
+	// and only runs which differ go through ApplyPatch() line by line.
+	struct CompiledPatchRun
+	{
+		patch_cpu_type cpu;
+		u32 addr;
+		u32 size; // 0 for lines which have to be interpreted, i.e. extended
+		u32 data_offset;
+		u32 first_command;
+		u32 num_commands;
+	};
+
+	struct CompiledPatchList
+	{
+		std::vector<CompiledPatchRun> runs;
+		std::vector<const PatchCommand*> commands;
+		std::vector<u8> data;
+	};
+
 	namespace PatchFunc
 	{
 		static void patch(PatchGroup* group, const std::string_view cmd, const std::string_view param);
@@ -156,8 +178,12 @@ namespace Patch
 	static void ReloadEnabledLists();
 	static u32 EnablePatches(const PatchList& patches, const EnablePatchList& enable_list);
 
+	static u32 GetPatchWriteBytes(const PatchCommand* p, u8* buffer);
+	static void CompileActivePatches();
+	static void IndexDynamicPatches();
+
 	static void ApplyPatch(const PatchCommand* p);
-	static void ApplyDynaPatch(const DynamicPatch& patch, u32 address);
+	static bool ApplyDynaPatch(const DynamicPatch& patch, u32 address);
 	static void writeCheat();
 	static void handle_extended_t(const PatchCommand* p);
 
@@ -176,7 +202,12 @@ namespace Patch
 	static PatchList s_cheat_patches;
 
 	static ActivePatchList s_active_patches;
+	static std::array<CompiledPatchList, PPT_END_MARKER> s_compiled_patches;
 	static std::vector<DynamicPatch> s_active_dynamic_patches;
+
+	// Dynamic patches by the word their pattern expects at the PC, and those without one.
+	static std::unordered_map<u32, std::vector<u32>> s_dynamic_patch_index;
+	static std::vector<u32> s_unindexed_dynamic_patches;
 	static EnablePatchList s_enabled_cheats;
 	static EnablePatchList s_enabled_patches;
 	static u32 s_patches_crc;
@@ -712,6 +743,8 @@ void Patch::UpdateActivePatches(bool reload_enabled_list, bool verbose, bool ver
 			TRANSLATE_PLURAL_STR("Patch", "%n cheat patches are active.", "OSD Message", c_count));
 	}
 
+	CompileActivePatches();
+
 	// Display message on first boot when we load patches.
 	// Except when it's just GameDB.
 	const bool just_gamedb = (p_count == 0 && c_count == 0 && gp_count > 0);
@@ -789,7 +822,10 @@ void Patch::UnloadPatches()
 	s_override_aspect_ratio = {};
 	s_patches_crc = 0;
 	s_active_patches = {};
+	s_compiled_patches = {};
 	s_active_dynamic_patches = {};
+	s_dynamic_patch_index = {};
+	s_unindexed_dynamic_patches = {};
 	s_enabled_patches = {};
 	s_enabled_cheats = {};
 	decltype(s_cheat_patches)().swap(s_cheat_patches);
@@ -901,26 +937,165 @@ void Patch::PatchFunc::gsinterlacemode(PatchGroup* group, const std::string_view
 	group->override_interlace_mode = static_cast<GSInterlaceMode>(interlace_mode.value());
 }
 
+// Returns the number of bytes a patch line writes, or 0 if it isn't a plain constant write.
+u32 Patch::GetPatchWriteBytes(const PatchCommand* p, u8* buffer)
+{
+	const auto store = [buffer](auto value) {
+		std::memcpy(buffer, &value, sizeof(value));
+		return static_cast<u32>(sizeof(value));
+	};
+
+	switch (p->type)
+	{
+		case BYTE_T:
+			return store(static_cast<u8>(p->data));
+		case SHORT_T:
+			return store(static_cast<u16>(p->data));
+		case WORD_T:
+			return store(static_cast<u32>(p->data));
+		case BYTES_T:
+			return static_cast<u32>(p->data);
+		default:
+			break;
+	}
+
+	// Everything else is EE only.
+	if (p->cpu != CPU_EE)
+		return 0;
+
+	switch (p->type)
+	{
+		case DOUBLE_T:
+			return store(p->data);
+		case SHORT_BE_T:
+			return store(ByteSwap(static_cast<u16>(p->data)));
+		case WORD_BE_T:
+			return store(ByteSwap(static_cast<u32>(p->data)));
+		case DOUBLE_BE_T:
+			return store(ByteSwap(p->data));
+		default:
+			return 0;
+	}
+}
+
+void Patch::CompileActivePatches()
+{
+	for (CompiledPatchList& list : s_compiled_patches)
+	{
+		list.runs.clear();
+		list.commands.clear();
+		list.data.clear();
+	}
+
+	for (const PatchCommand* p : s_active_patches)
+	{
+		if (p->placetopatch >= PPT_END_MARKER)
+			continue;
+
+		CompiledPatchList& list = s_compiled_patches[p->placetopatch];
+
+		u8 buffer[sizeof(u64)];
+		const u32 size = GetPatchWriteBytes(p, buffer);
+
+		// Drop lines which ApplyPatch() would ignore anyway.
+		if (size == 0 && (p->cpu != CPU_EE || p->type != EXTENDED_T))
+			continue;
+
+		// Lines are only merged when they follow on from each other, so they never overlap, and
+		// comparing the run is the same as comparing each line.
+		CompiledPatchRun* run = list.runs.empty() ? nullptr : &list.runs.back();
+		if (size == 0 || !run || run->size == 0 || run->cpu != p->cpu || (run->addr + run->size) != p->addr)
+		{
+			run = &list.runs.emplace_back(CompiledPatchRun{p->cpu, p->addr, 0, static_cast<u32>(list.data.size()),
+				static_cast<u32>(list.commands.size()), 0});
+		}
+
+		const u8* data = (p->type == BYTES_T) ? p->data_ptr : buffer;
+		list.data.insert(list.data.end(), data, data + size);
+		list.commands.push_back(p);
+		run->size += size;
+		run->num_commands++;
+	}
+
+	DevCon.WriteLnFmt("Compiled {} active patch lines into {}/{}/{} runs.", s_active_patches.size(),
+		s_compiled_patches[PPT_ONCE_ON_LOAD].runs.size(), s_compiled_patches[PPT_CONTINUOUSLY].runs.size(),
+		s_compiled_patches[PPT_COMBINED_0_1].runs.size());
+}
+
 // This is for applying patches directly to memory
 void Patch::ApplyLoadedPatches(patch_place_type place)
 {
-	for (const PatchCommand* i : s_active_patches)
+	const CompiledPatchList& list = s_compiled_patches[place];
+	for (const CompiledPatchRun& run : list.runs)
 	{
-		if (i->placetopatch == place)
-			ApplyPatch(i);
+		// With the EE cache emulated, RAM can be stale next to the cache, so the lines have to go through the
+		// memory handlers to see what the game sees.
+		if (run.size > 0 && (run.cpu != CPU_EE || !CHECK_CACHE))
+		{
+			// Handlers and unmapped pages come back as different, and get the line by line treatment.
+			const u8* data = &list.data[run.data_offset];
+			const int res = (run.cpu == CPU_EE) ? vtlb_memSafeCmpBytes(run.addr, data, run.size) :
+												  iopMemSafeCmpBytes(run.addr, data, run.size);
+			if (res == 0)
+				continue;
+		}
+
+		for (u32 i = 0; i < run.num_commands; i++)
+			ApplyPatch(list.commands[run.first_command + i]);
 	}
 }
 
 void Patch::ApplyDynamicPatches(u32 pc)
 {
-	for (const auto& dynpatch : s_active_dynamic_patches)
-		ApplyDynaPatch(dynpatch, pc);
+	if (s_active_dynamic_patches.empty())
+		return;
+
+	const auto it = s_dynamic_patch_index.find(*static_cast<u32*>(PSM(pc)));
+	const std::span<const u32> indexed = (it != s_dynamic_patch_index.end()) ? std::span<const u32>(it->second) : std::span<const u32>();
+	const std::span<const u32> unindexed = s_unindexed_dynamic_patches;
+
+	// Check the candidates in their original order.
+	size_t indexed_pos = 0, unindexed_pos = 0;
+	while (indexed_pos < indexed.size() || unindexed_pos < unindexed.size())
+	{
+		u32 idx;
+		if (unindexed_pos == unindexed.size() || (indexed_pos < indexed.size() && indexed[indexed_pos] < unindexed[unindexed_pos]))
+			idx = indexed[indexed_pos++];
+		else
+			idx = unindexed[unindexed_pos++];
+
+		if (ApplyDynaPatch(s_active_dynamic_patches[idx], pc))
+		{
+			// The replacement may have changed which of the remaining patches match, so don't trust the index.
+			for (size_t i = idx + 1; i < s_active_dynamic_patches.size(); i++)
+				ApplyDynaPatch(s_active_dynamic_patches[i], pc);
+			return;
+		}
+	}
 }
 
 void Patch::LoadDynamicPatches(const std::vector<DynamicPatch>& patches)
 {
 	for (const DynamicPatch& it : patches)
 		s_active_dynamic_patches.push_back(it);
+
+	IndexDynamicPatches();
+}
+
+void Patch::IndexDynamicPatches()
+{
+	s_dynamic_patch_index.clear();
+	s_unindexed_dynamic_patches.clear();
+
+	for (u32 i = 0; i < static_cast<u32>(s_active_dynamic_patches.size()); i++)
+	{
+		const std::vector<DynamicPatchEntry>& pattern = s_active_dynamic_patches[i].pattern;
+		const auto entry = std::find_if(pattern.begin(), pattern.end(), [](const DynamicPatchEntry& e) { return e.offset == 0; });
+		if (entry != pattern.end())
+			s_dynamic_patch_index[entry->value].push_back(i);
+		else
+			s_unindexed_dynamic_patches.push_back(i);
+	}
 }
 
 static u32 SkipCount = 0, IterationCount = 0;
@@ -1507,12 +1682,12 @@ void Patch::ApplyPatch(const PatchCommand* p)
 	}
 }
 
-void Patch::ApplyDynaPatch(const DynamicPatch& patch, u32 address)
+bool Patch::ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 {
 	for (const auto& pattern : patch.pattern)
 	{
 		if (*static_cast<u32*>(PSM(address + pattern.offset)) != pattern.value)
-			return;
+			return false;
 	}
 
 	Console.WriteLn("Applying Dynamic Patch to address 0x%08X", address);
@@ -1521,4 +1696,6 @@ void Patch::ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 	{
 		memWrite32(address + replacement.offset, replacement.value);
 	}
+
+	return true;
 }
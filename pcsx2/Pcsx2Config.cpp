@@ -363,6 +363,7 @@ Pcsx2Config::RecompilerOptions::RecompilerOptions()
 	EnableVU0 = true;
 	EnableVU1 = true;
 	EnableFastmem = true;
+	EnableEESuperblocks = false;
 	PauseOnTLBMiss = false;
 
 	// vu and fpu clamping default to standard overflow.
@@ -441,6 +442,7 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 	SettingsWrapBitBool(EnableFastmem);
+	SettingsWrapBitBool(EnableEESuperblocks);
 	SettingsWrapBitBool(PauseOnTLBMiss);
 
 	SettingsWrapBitBool(vu0Overflow);
@@ -746,6 +748,7 @@ bool Pcsx2Config::GSOptions::OptionsAreEqual(const GSOptions& right) const
 		OpEqu(PNGCompressionLevel) &&
 		OpEqu(SaveN) &&
 		OpEqu(SaveL) &&
+		OpEqu(GSDumpKeyframeInterval) &&
 
 		OpEqu(ExclusiveFullscreenControl) &&
 		OpEqu(ScreenshotSize) &&
@@ -929,6 +932,7 @@ void Pcsx2Config::GSOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitfieldEx(PNGCompressionLevel, "png_compression_level");
 	SettingsWrapBitfieldEx(SaveN, "saven");
 	SettingsWrapBitfieldEx(SaveL, "savel");
+	SettingsWrapBitfieldEx(GSDumpKeyframeInterval, "GSDumpKeyframeInterval");
 
 	SettingsWrapEntryEx(CaptureContainer, "CaptureContainer");
 	SettingsWrapEntryEx(VideoCaptureCodec, "VideoCaptureCodec");
@@ -1227,6 +1231,7 @@ void Pcsx2Config::DEV9Options::LoadSave(SettingsWrapper& wrap)
 		SettingsWrapSection("DEV9/Hdd");
 		SettingsWrapEntry(HddEnable);
 		SettingsWrapEntry(HddFile);
+		SettingsWrapEntry(HddOverlayFile);
 	}
 }
 
@@ -1257,7 +1262,8 @@ bool Pcsx2Config::DEV9Options::operator==(const DEV9Options& right) const
 		   OpEqu(EthHosts) &&
 
 		   OpEqu(HddEnable) &&
-		   OpEqu(HddFile);
+		   OpEqu(HddFile) &&
+		   OpEqu(HddOverlayFile);
 }
 
 void Pcsx2Config::DEV9Options::LoadIPHelper(u8* field, const std::string& setting)
@@ -1305,6 +1311,7 @@ static const char* const tbl_GamefixNames[] =
 		"XGKick",
 		"BlitInternalFPS",
 		"FullVU0Sync",
+		"EECache",
 };
 
 const char* Pcsx2Config::GamefixOptions::GetGameFixName(GamefixId id)
@@ -1347,6 +1354,7 @@ void Pcsx2Config::GamefixOptions::Set(GamefixId id, bool enabled)
 		case Fix_VUOverflow:          VUOverflowHack          = enabled; break;
 		case Fix_BlitInternalFPS:     BlitInternalFPSHack     = enabled; break;
 		case Fix_FullVU0Sync:         FullVU0SyncHack         = enabled; break;
+		case Fix_EECache:             EECacheHack             = enabled; break;
 		default:                                                         break;
 			// clang-format on
 	}
@@ -1385,6 +1393,7 @@ bool Pcsx2Config::GamefixOptions::Get(GamefixId id) const
 		case Fix_VUOverflow:          return VUOverflowHack;
 		case Fix_BlitInternalFPS:     return BlitInternalFPSHack;
 		case Fix_FullVU0Sync:         return FullVU0SyncHack;
+		case Fix_EECache:             return EECacheHack;
 		default:                      return false;
 			// clang-format on
 	}
@@ -1413,6 +1422,7 @@ void Pcsx2Config::GamefixOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(VUOverflowHack);
 	SettingsWrapBitBool(BlitInternalFPSHack);
 	SettingsWrapBitBool(FullVU0SyncHack);
+	SettingsWrapBitBool(EECacheHack);
 }
 
 
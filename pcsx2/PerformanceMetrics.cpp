@@ -13,7 +13,9 @@
 #include "GS/GSCapture.h"
 #include "MTGS.h"
 #include "MTVU.h"
+#include "R3000A.h"
 #include "VMManager.h"
+#include "SPU2/spu2.h"
 
 static const float UPDATE_INTERVAL = 0.5f;
 
@@ -54,6 +56,11 @@ static float s_vu_thread_time = 0.0f;
 static float s_capture_thread_usage = 0.0f;
 static float s_capture_thread_time = 0.0f;
 
+static u32 s_last_iop_cycle = 0;
+static double s_iop_cycles_per_second = 0.0;
+
+static AudioStreamStats s_audio_stream_stats;
+
 static PerformanceMetrics::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
 
@@ -94,6 +101,8 @@ void PerformanceMetrics::Clear()
 	s_average_gpu_time = 0.0f;
 	s_gpu_usage = 0.0f;
 
+	s_audio_stream_stats = {};
+
 	s_frame_number = 0;
 
 	s_frame_time_history.fill(0.0f);
@@ -121,6 +130,7 @@ void PerformanceMetrics::Reset()
 	s_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
 	s_last_ticks = GetCPUTicks();
 	s_last_capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadHandle().GetCPUTime() : 0;
+	s_last_iop_cycle = psxRegs.cycle;
 
 	for (GSSWThreadStats& stat : s_gs_sw_threads)
 		stat.last_cpu_time = stat.handle.GetCPUTime();
@@ -212,6 +222,12 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 	s_vu_thread_time = static_cast<double>(vu_delta) * time_divider;
 	s_capture_thread_time = static_cast<double>(capture_delta) * time_divider;
 
+	const u32 iop_cycle = psxRegs.cycle;
+	s_iop_cycles_per_second = static_cast<double>(iop_cycle - s_last_iop_cycle) / static_cast<double>(time);
+	s_last_iop_cycle = iop_cycle;
+
+	s_audio_stream_stats = SPU2::GetOutputStreamStats();
+
 	for (GSSWThreadStats& thread : s_gs_sw_threads)
 	{
 		const u64 time = thread.handle.GetCPUTime();
@@ -327,6 +343,16 @@ float PerformanceMetrics::GetVUThreadAverageTime()
 	return s_vu_thread_time;
 }
 
+double PerformanceMetrics::GetIOPCyclesPerSecond()
+{
+	return s_iop_cycles_per_second;
+}
+
+const AudioStreamStats& PerformanceMetrics::GetAudioStreamStats()
+{
+	return s_audio_stream_stats;
+}
+
 float PerformanceMetrics::GetCaptureThreadUsage()
 {
 	return s_capture_thread_usage;
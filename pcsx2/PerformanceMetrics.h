@@ -5,6 +5,7 @@
 
 #include <array>
 #include "common/Threading.h"
+#include "Host/AudioStreamTypes.h"
 
 namespace PerformanceMetrics
 {
@@ -51,6 +52,13 @@ namespace PerformanceMetrics
 	float GetCaptureThreadUsage();
 	float GetCaptureThreadAverageTime();
 
+	/// Returns the number of IOP cycles executed per host second. Only meaningful as a measure of IOP
+	/// throughput when the frame limiter is off.
+	double GetIOPCyclesPerSecond();
+
+	/// Returns the audio output statistics as of the last update: buffer fill, underruns and time stretch cost.
+	const AudioStreamStats& GetAudioStreamStats();
+
 	u32 GetGSSWThreadCount();
 	double GetGSSWThreadUsage(u32 index);
 	double GetGSSWThreadAverageTime(u32 index);
@@ -258,7 +258,7 @@ static __forceinline StereoOut32 ApplyVolume(const StereoOut32& data, const V_Vo
 		ApplyVolume(data.Right, volume.Right.Value));
 }
 
-static void __forceinline UpdatePitch(uint coreidx, uint voiceidx)
+static void __forceinline UpdatePitch(uint coreidx, uint voiceidx, s32 modulator)
 {
 	V_Voice& vc(Cores[coreidx].Voices[voiceidx]);
 	s32 pitch;
@@ -270,7 +270,7 @@ static void __forceinline UpdatePitch(uint coreidx, uint voiceidx)
 	if ((vc.Modulated == 0) || (voiceidx == 0))
 		pitch = vc.Pitch;
 	else
-		pitch = std::clamp((vc.Pitch * (32768 + Cores[coreidx].Voices[voiceidx - 1].OutX)) >> 15, 0, 0x3fff);
+		pitch = std::clamp((vc.Pitch * (32768 + modulator)) >> 15, 0, 0x3fff);
 
 	pitch = std::min(pitch, 0x3FFF);
 	vc.SP += pitch;
@@ -398,7 +398,8 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 }
 
 
-static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
+// modulator is the OutX of the previous voice, out_pos the write-back position for voices 1 and 3.
+static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx, s32 modulator, u32 out_pos)
 {
 	V_Core& thiscore(Cores[coreidx]);
 	V_Voice& vc(thiscore.Voices[voiceidx]);
@@ -417,7 +418,7 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 	// have to run through all the motions of updating the voice regardless of it's
 	// audible status.  Otherwise IRQs might not trigger and emulation might fail.
 
-	UpdatePitch(coreidx, voiceidx);
+	UpdatePitch(coreidx, voiceidx, modulator);
 
 	StereoOut32 voiceOut(0, 0);
 	s32 Value = 0;
@@ -448,9 +449,9 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 	// Write-back of raw voice data (post ADSR applied)
 	if (voiceidx == 1)
-		spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, Value);
+		spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + out_pos, Value);
 	else if (voiceidx == 3)
-		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
+		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + out_pos, Value);
 
 	return voiceOut;
 }
@@ -463,7 +464,8 @@ static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+		const s32 modulator = (voiceidx != 0) ? thiscore.Voices[voiceidx - 1].OutX : 0;
+		StereoOut32 VVal(MixVoice(coreidx, voiceidx, modulator, OutPos));
 
 		// Note: Results from MixVoice are ranged at 16 bits.
 
@@ -474,6 +476,170 @@ static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 	}
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                     //
+// Block mixing
+//
+// Voices only interact with the rest of the mixer through IRQs, key on, pitch modulation
+// and the memory the mixer writes to.  When none of those can happen over the next few
+// ticks, each voice is run through the whole block in one go, and only the input, core
+// mix, reverb and output steps are left to run a sample at a time.
+
+static VoiceMixSet s_block_voices[SPU2_MIX_BLOCK_SIZE][2];
+
+// Upper bound on how far a voice's address can move in the given number of ticks.  With
+// the pitch capped, a voice steps through at most 2 data words per tick (stopped voices
+// included), plus one header word per 7 data words.
+static constexpr u32 GetVoiceReach(u32 samples)
+{
+	return samples * 4 + pcm_WordsPerBlock * 2;
+}
+
+// Whether the circular range [start, start + size] of SPU2 memory overlaps [lo, hi].
+static __forceinline bool RangeOverlaps(u32 start, u32 size, u32 lo, u32 hi)
+{
+	return ((lo - start) & 0xFFFFF) <= size || (start >= lo && start <= hi);
+}
+
+// Whether the circular ranges [a, a + size] and [b, b + size] of SPU2 memory overlap.
+static __forceinline bool RangesOverlap(u32 a, u32 b, u32 size)
+{
+	return ((b - a) & 0xFFFFF) <= size || ((a - b) & 0xFFFFF) <= size;
+}
+
+bool spu2CanMixBlock(u32 samples)
+{
+	struct Hazard
+	{
+		u32 lo, hi;
+	};
+
+	// Everything below the dynamic memory line is written by the mixer itself.
+	Hazard hazards[5] = {{0, SPU2_DYN_MEMLINE - 1}};
+	uint num_hazards = 1;
+
+	for (int i = 0; i < 2; i++)
+	{
+		const V_Core& thiscore(Cores[i]);
+		if (thiscore.KeyOn != 0)
+			return false;
+
+		// Voices 1 and 3 write back to 0x400-0x7FF and 0xC00-0xFFF, which would move the IRQ to the wrong tick.
+		if (thiscore.IRQEnable)
+		{
+			if ((thiscore.IRQA & 0xFFFFF400) == 0x400)
+				return false;
+
+			hazards[num_hazards++] = {thiscore.IRQA, thiscore.IRQA};
+		}
+
+		// Reverb writes to its work area without invalidating the cache, and could read the write-back area.
+		if (thiscore.EffectsStartA < thiscore.EffectsEndA)
+		{
+			const u32 lo = thiscore.EffectsStartA & 0x3FFFFF;
+			const u32 hi = (thiscore.EffectsEndA & 0x3FFFFF) | 0xFFFF;
+			if (hi > 0xFFFFF || lo < 0x1000)
+				return false;
+
+			hazards[num_hazards++] = {lo, hi};
+		}
+	}
+
+	// A loop point found in the first stretch can move the voice at most one more stretch further.
+	const u32 reach = GetVoiceReach(samples) * 2;
+
+	struct VoiceReach
+	{
+		u32 next, loop;
+	};
+	VoiceReach voices[2 * V_Core::NumVoices];
+	uint num_voices = 0;
+
+	for (int i = 0; i < 2; i++)
+	{
+		for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		{
+			const V_Voice& vc(Cores[i].Voices[voiceidx]);
+
+			// Both depend on state which is only updated per sample outside of the voices.
+			if (vc.PendingLoopStart || (vc.Noise && vc.ADSR.Phase > V_ADSR::PHASE_STOPPED))
+				return false;
+
+			const u32 next = vc.NextA & 0xFFFF8;
+			const u32 loop = vc.LoopStartA & 0xFFFF8;
+			for (uint h = 0; h < num_hazards; h++)
+			{
+				if (RangeOverlaps(next, reach, hazards[h].lo, hazards[h].hi) ||
+					RangeOverlaps(loop, reach, hazards[h].lo, hazards[h].hi))
+					return false;
+			}
+
+			// Stopped voices only read the headers, never the decoded cache.
+			if (vc.ADSR.Phase > V_ADSR::PHASE_STOPPED)
+				voices[num_voices++] = {next, loop};
+		}
+	}
+
+	// Playing voices reading the same ADPCM block share its cache line, and whichever decodes it first
+	// leaves its own filter history in there.  Running voices one after the other would change who gets
+	// there first, so those voices have to stay clear of each other.
+	for (uint i = 0; i < num_voices; i++)
+	{
+		const VoiceReach& a = voices[i];
+		for (uint j = i + 1; j < num_voices; j++)
+		{
+			const VoiceReach& b = voices[j];
+			if (RangesOverlap(a.next, b.next, reach) || RangesOverlap(a.next, b.loop, reach) ||
+				RangesOverlap(a.loop, b.next, reach) || RangesOverlap(a.loop, b.loop, reach))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void spu2MixVoicesBlock(u32 samples)
+{
+	pxAssume(samples <= SPU2_MIX_BLOCK_SIZE);
+
+	// Voice state refers to the tick counter for loop points, which would normally advance as we go.
+	const u32 start_cycles = Cycles;
+
+	for (uint coreidx = 0; coreidx < 2; coreidx++)
+	{
+		V_Core& thiscore(Cores[coreidx]);
+
+		// Output of the previous voice for each sample, used for pitch modulation.
+		s32 modulators[SPU2_MIX_BLOCK_SIZE];
+
+		for (u32 i = 0; i < samples; i++)
+			s_block_voices[i][coreidx] = VoiceMixSet::Empty;
+
+		for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		{
+			const V_VoiceGates& gates(thiscore.VoiceGates[voiceidx]);
+			const V_Voice& vc(thiscore.Voices[voiceidx]);
+			const bool modulated = (voiceidx != 0);
+
+			for (u32 i = 0; i < samples; i++)
+			{
+				Cycles = start_cycles + i;
+
+				const StereoOut32 VVal(MixVoice(coreidx, voiceidx, modulated ? modulators[i] : 0, (OutPos + i) & 0x1FF));
+				modulators[i] = vc.OutX;
+
+				VoiceMixSet& dest = s_block_voices[i][coreidx];
+				dest.Dry.Left += VVal.Left & gates.DryL;
+				dest.Dry.Right += VVal.Right & gates.DryR;
+				dest.Wet.Left += VVal.Left & gates.WetL;
+				dest.Wet.Right += VVal.Right & gates.WetR;
+			}
+		}
+	}
+
+	Cycles = start_cycles;
+}
+
 StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
 {
 	MasterVol.Update();
@@ -567,7 +733,7 @@ static StereoOut32 DCFilter(StereoOut32 input) {
 	return output;
 }
 
-__forceinline void spu2Mix()
+static __forceinline void MixSample(const VoiceMixSet* block_voices)
 {
 	// Note: Playmode 4 is SPDIF, which overrides other inputs.
 	StereoOut32 InputData[2] =
@@ -588,8 +754,16 @@ __forceinline void spu2Mix()
 
 	// Todo: Replace me with memzero initializer!
 	VoiceMixSet VoiceData[2] = {VoiceMixSet::Empty, VoiceMixSet::Empty}; // mixed voice data for each core.
-	MixCoreVoices(VoiceData[0], 0);
-	MixCoreVoices(VoiceData[1], 1);
+	if (block_voices)
+	{
+		VoiceData[0] = block_voices[0];
+		VoiceData[1] = block_voices[1];
+	}
+	else
+	{
+		MixCoreVoices(VoiceData[0], 0);
+		MixCoreVoices(VoiceData[1], 1);
+	}
 
 	StereoOut32 Ext(Cores[0].Mix(VoiceData[0], InputData[0], StereoOut32::Empty));
 
@@ -666,3 +840,13 @@ __forceinline void spu2Mix()
 		}
 	}
 }
+
+void spu2Mix()
+{
+	MixSample(nullptr);
+}
+
+void spu2MixBlockSample(u32 index)
+{
+	MixSample(s_block_voices[index]);
+}
@@ -43,18 +43,6 @@ void V_Core::AnalyzeReverbPreset()
 	Console.WriteLn("----------------------------------------------------------");
 }
 
-__forceinline s32 V_Core::RevbGetIndexer(s32 offset)
-{
-	u32 start = EffectsStartA & 0x3f'ffff;
-	u32 end = (EffectsEndA & 0x3f'ffff) | 0xffff;
-
-	u32 x = ((Cycles >> 1) + offset) % ((end - start) + 1);
-
-	x += start;
-
-	return x & 0xf'ffff;
-}
-
 StereoOut32 V_Core::DoReverb(StereoOut32 Input)
 {
 	if (EffectsStartA >= EffectsEndA)
@@ -72,6 +60,7 @@ StereoOut32 V_Core::DoReverb(StereoOut32 Input)
 	bool R = Cycles & 1;
 
 	// Calculate the read/write addresses we'll be needing for this session of reverb.
+	const ReverbIndexer RevbGetIndexer(Cycles, EffectsStartA, EffectsEndA);
 
 	const u32 same_src = RevbGetIndexer(R ? Revb.SAME_R_SRC : Revb.SAME_L_SRC);
 	const u32 same_dst = RevbGetIndexer(R ? Revb.SAME_R_DST : Revb.SAME_L_DST);
@@ -146,6 +146,17 @@ s32 ReverbDownsample(V_Core& core, bool right)
 #endif
 }
 
+// Reduces both channels together. The lanes are paired in the same order as reducing each channel on its own,
+// so the saturation points, and therefore the results, are identical.
+static __forceinline StereoOut32 ReverbUpsampleReduce(const GSVector4i& lacc, const GSVector4i& racc)
+{
+	GSVector4i acc = lacc.hadds16(racc); // [l01, l23, l45, l67, r01, r23, r45, r67]
+	acc = acc.hadds16(acc); // [l0-3, l4-7, r0-3, r4-7, ...]
+	acc = acc.hadds16(acc); // [l, r, ...]
+
+	return {acc.I16[0], acc.I16[1]};
+}
+
 StereoOut32 __forceinline ReverbUpsample_reference(V_Core& core)
 {
 	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
@@ -190,15 +201,7 @@ StereoOut32 __forceinline ReverbUpsample_avx(V_Core& core)
 	lacc = lacc.adds16(lacc.ba());
 	racc = racc.adds16(racc.ba());
 
-	lacc = lacc.hadds16(lacc);
-	lacc = lacc.hadds16(lacc);
-	lacc = lacc.hadds16(lacc);
-
-	racc = racc.hadds16(racc);
-	racc = racc.hadds16(racc);
-	racc = racc.hadds16(racc);
-
-	return {lacc.I16[0], racc.I16[0]};
+	return ReverbUpsampleReduce(lacc.extract<0>(), racc.extract<0>());
 }
 #endif
 
@@ -237,15 +240,7 @@ StereoOut32 __forceinline ReverbUpsample_sse(V_Core& core)
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
-	lacc = lacc.hadds16(lacc);
-	lacc = lacc.hadds16(lacc);
-	lacc = lacc.hadds16(lacc);
-
-	racc = racc.hadds16(racc);
-	racc = racc.hadds16(racc);
-	racc = racc.hadds16(racc);
-
-	return {lacc.I16[0], racc.I16[0]};
+	return ReverbUpsampleReduce(lacc, racc);
 }
 
 StereoOut32 ReverbUpsample(V_Core& core)
@@ -67,6 +67,12 @@ extern s16 spu2M_Read(u32 addr);
 extern void spu2M_Write(u32 addr, s16 value);
 extern void spu2M_Write(u32 addr, u16 value);
 extern void spu2Mix();
+
+// Mixing a block of ticks at a time, see Mixer.cpp.
+static constexpr u32 SPU2_MIX_BLOCK_SIZE = 32;
+extern bool spu2CanMixBlock(u32 samples);
+extern void spu2MixVoicesBlock(u32 samples);
+extern void spu2MixBlockSample(u32 index);
 extern void spu2Output(StereoOut32 out);
 
 static __forceinline s16 SignExtend16(u16 v)
@@ -525,7 +531,6 @@ struct V_Core
 
 	StereoOut32 Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext);
 	StereoOut32 DoReverb(StereoOut32 Input);
-	s32 RevbGetIndexer(s32 offset);
 
 	StereoOut32 ReadInput();
 	StereoOut32 ReadInput_HiFi();
@@ -583,6 +588,43 @@ MULTI_ISA_DEF(
 extern StereoOut32 (*ReverbUpsample)(V_Core& core);
 extern s32 (*ReverbDownsample)(V_Core& core, bool right);
 
+// Resolves offsets into the reverb work area for the current sample. The area isn't a power of two in size, so
+// the position is reduced once per sample, and offsets within the area only need a compare to wrap around.
+struct ReverbIndexer
+{
+	u32 start;
+	u32 size;
+	u32 base;
+	u32 base_mod;
+
+	ReverbIndexer(u32 cycles, u32 effects_start, u32 effects_end)
+	{
+		start = effects_start & 0x3f'ffff;
+		size = ((effects_end & 0x3f'ffff) | 0xffff) - start + 1;
+		base = cycles >> 1;
+		base_mod = base % size;
+	}
+
+	__fi u32 operator()(u32 offset) const
+	{
+		u32 x;
+		if (offset < size)
+		{
+			// The base is at most 31 bits and the area at most 22, so the sum can't wrap here.
+			x = base_mod + offset;
+			if (x >= size)
+				x -= size;
+		}
+		else
+		{
+			// Wraps at 32 bits, same as the hardware address counter.
+			x = (base + offset) % size;
+		}
+
+		return (x + start) & 0xf'ffff;
+	}
+};
+
 extern V_Core Cores[2];
 extern V_SPDIF Spdif;
 
@@ -8,12 +8,16 @@
 #include "Host/AudioStream.h"
 #include "Host.h"
 #include "GS/GSCapture.h"
+#include "IopHw.h"
 #include "MTGS.h"
 #include "R3000A.h"
 #include "VMManager.h"
 
 #include "common/Error.h"
 
+#include <algorithm>
+#include <mutex>
+
 const StereoOut32 StereoOut32::Empty(0, 0);
 
 namespace SPU2
@@ -22,6 +26,7 @@ namespace SPU2
 	static void UpdateSampleRate();
 	static float GetNominalRate();
 	static void InternalReset(bool psxmode);
+	static void UpdateOutputStreamStats();
 } // namespace SPU2
 
 u32 lClocks = 0;
@@ -33,11 +38,34 @@ static std::unique_ptr<AudioStream> s_output_stream;
 static std::array<s16, AudioStream::CHUNK_SIZE * 2> s_current_chunk;
 static u32 s_current_chunk_pos;
 
+// Copied out of the stream once per statistics window, so the performance overlay can read it from the GS thread.
+static std::mutex s_output_stream_stats_mutex;
+static AudioStreamStats s_output_stream_stats;
+
 u32 SPU2::GetConsoleSampleRate()
 {
 	return s_psxmode ? PSX_SAMPLE_RATE : SAMPLE_RATE;
 }
 
+// SPU2async() can let the IOP skip a few updates while nothing can interrupt the mixer.
+// Anything that touches the SPU2 may change that, so it goes back to updating every tick.
+static void EndIdleUpdate()
+{
+	if (psxCounters[6].deltaCycles <= static_cast<s32>(psxCounters[6].rate))
+		return;
+
+	// The next tick is due at lClocks + rate, or right away if we haven't caught up (DMA register reads).
+	psxCounters[6].startCycle = lClocks;
+	psxCounters[6].deltaCycles = psxCounters[6].rate;
+
+	psxNextDeltaCounter -= (psxRegs.cycle - psxNextStartCounter);
+	psxNextStartCounter = psxRegs.cycle;
+	const s32 delta = std::max(static_cast<s32>(lClocks + psxCounters[6].rate - psxRegs.cycle), 0);
+	if (delta < psxNextDeltaCounter)
+		psxNextDeltaCounter = delta;
+	psxSetNextBranch(psxNextStartCounter, psxNextDeltaCounter);
+}
+
 // --------------------------------------------------------------------------------------
 //  DMA 4/7 Callbacks from Core Emulator
 // --------------------------------------------------------------------------------------
@@ -46,6 +74,7 @@ u32 SPU2::GetConsoleSampleRate()
 void SPU2readDMA4Mem(u16* pMem, u32 size) // size now in 16bit units
 {
 	TimeUpdate(psxRegs.cycle);
+	EndIdleUpdate();
 
 	SPU2::FileLog("[%10d] SPU2 readDMA4Mem size %x\n", Cycles, size << 1);
 	Cores[0].DoDMAread(pMem, size);
@@ -54,6 +83,7 @@ void SPU2readDMA4Mem(u16* pMem, u32 size) // size now in 16bit units
 void SPU2writeDMA4Mem(u16* pMem, u32 size) // size now in 16bit units
 {
 	TimeUpdate(psxRegs.cycle);
+	EndIdleUpdate();
 
 	SPU2::FileLog("[%10d] SPU2 writeDMA4Mem size %x at address %x\n", Cycles, size << 1, Cores[0].TSA);
 
@@ -81,6 +111,7 @@ void SPU2interruptDMA7()
 void SPU2readDMA7Mem(u16* pMem, u32 size)
 {
 	TimeUpdate(psxRegs.cycle);
+	EndIdleUpdate();
 
 	SPU2::FileLog("[%10d] SPU2 readDMA7Mem size %x\n", Cycles, size << 1);
 	Cores[1].DoDMAread(pMem, size);
@@ -89,6 +120,7 @@ void SPU2readDMA7Mem(u16* pMem, u32 size)
 void SPU2writeDMA7Mem(u16* pMem, u32 size)
 {
 	TimeUpdate(psxRegs.cycle);
+	EndIdleUpdate();
 
 	SPU2::FileLog("[%10d] SPU2 writeDMA7Mem size %x at address %x\n", Cycles, size << 1, Cores[1].TSA);
 
@@ -117,6 +149,19 @@ void SPU2::CreateOutputStream()
 	s_output_stream->SetOutputVolume(volume);
 	s_output_stream->SetNominalRate(GetNominalRate());
 	s_output_stream->SetPaused(VMManager::GetState() == VMState::Paused);
+	UpdateOutputStreamStats();
+}
+
+void SPU2::UpdateOutputStreamStats()
+{
+	std::unique_lock lock(s_output_stream_stats_mutex);
+	s_output_stream_stats = s_output_stream ? s_output_stream->GetStats() : AudioStreamStats();
+}
+
+AudioStreamStats SPU2::GetOutputStreamStats()
+{
+	std::unique_lock lock(s_output_stream_stats_mutex);
+	return s_output_stream_stats;
 }
 
 void SPU2::UpdateSampleRate()
@@ -244,6 +289,7 @@ void SPU2::Close()
 	FileLog("[%10d] SPU2 Close\n", Cycles);
 
 	s_output_stream.reset();
+	UpdateOutputStreamStats();
 
 #ifdef PCSX2_DEVBUILD
 	WaveDump::Close();
@@ -300,6 +346,13 @@ void SPU2::CheckForConfigChanges(const Pcsx2Config& old_config)
 void SPU2async()
 {
 	TimeUpdate(psxRegs.cycle);
+
+	// The IOP counter update sets up the next SPU2 update one tick away, which we can push back
+	// when nothing needs to happen at tick granularity. TimeUpdate() then mixes the voices in blocks.
+	// DEV9 is polled from that same update though, and the SMAP and ATA expect it every tick.
+	if (psxCounters[6].deltaCycles == static_cast<s32>(psxCounters[6].rate) &&
+		!EmuConfig.DEV9.EthEnable && !EmuConfig.DEV9.HddEnable)
+		psxCounters[6].deltaCycles = psxCounters[6].rate * GetIdleTicks();
 }
 
 u16 SPU2read(u32 rmem)
@@ -351,6 +404,7 @@ u16 SPU2read(u32 rmem)
 		}
 	}
 
+	EndIdleUpdate();
 	return ret;
 }
 
@@ -371,6 +425,8 @@ void SPU2write(u32 rmem, u16 value)
 #endif
 		SPU2_FastWrite(rmem, value);
 	}
+
+	EndIdleUpdate();
 }
 
 s32 SPU2freeze(FreezeAction mode, freezeData* data)
@@ -422,6 +478,8 @@ __forceinline void spu2Output(StereoOut32 out)
 		s_current_chunk_pos = 0;
 
 		s_output_stream->WriteChunk(s_current_chunk.data());
+		if (s_output_stream->ConsumeStatsUpdate()) [[unlikely]]
+			SPU2::UpdateOutputStreamStats();
 
 		if (SPU2::IsAudioCaptureActive()) [[unlikely]]
 			GSCapture::DeliverAudioPacket(s_current_chunk.data());
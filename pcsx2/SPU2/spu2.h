@@ -5,6 +5,7 @@
 
 #include "SaveState.h"
 #include "IopCounters.h"
+#include "Host/AudioStreamTypes.h"
 
 #include <memory>
 
@@ -54,6 +55,9 @@ u32 GetConsoleSampleRate();
 /// Tells SPU2 to forward audio packets to GSCapture.
 void SetAudioCaptureActive(bool active);
 bool IsAudioCaptureActive();
+
+/// Returns the most recent output stream statistics. Safe to call from any thread.
+AudioStreamStats GetOutputStreamStats();
 } // namespace SPU2
 
 void SPU2write(u32 mem, u16 value);
@@ -72,6 +76,8 @@ void SPU2writeDMA7Mem(u16* pMem, u32 size);
 extern u32 lClocks;
 
 extern void TimeUpdate(u32 cClocks);
+// Number of ticks the SPU2 can run without the IOP checking in, as long as nothing accesses it in the meantime.
+extern u32 GetIdleTicks();
 extern void SPU2_FastWrite(u32 rmem, u16 value);
 
 //#define PCM24_S1_INTERLEAVE
@@ -219,6 +219,12 @@ void V_Voice::Stop()
 static constexpr uint TickInterval = 768;
 static constexpr int SanityInterval = 4800;
 
+// Below this many ticks, checking whether a block can be mixed costs more than it saves.
+static constexpr u32 MinBlockTicks = 4;
+
+// Ticks left before GetIdleTicks() looks at the voices again.
+static u32 s_idle_voice_backoff = 0;
+
 __forceinline static bool StartQueuedVoice(uint coreidx, uint voiceidx)
 {
 	V_Voice& vc(Cores[coreidx].Voices[voiceidx]);
@@ -254,6 +260,49 @@ __forceinline static bool StartQueuedVoice(uint coreidx, uint voiceidx)
 	return true;
 }
 
+u32 GetIdleTicks()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		// IRQs and DMA completion are only signalled from TimeUpdate().
+		if (has_to_call_irq[i] || has_to_call_irq_dma[i] || Cores[i].DMAICounter > 0)
+			return 1;
+
+		// AutoDMA refills are requested from ReadInput().
+		if (Cores[i].AdmaInProgress || Cores[i].InputDataLeft || Cores[i].InputDataTransferred)
+			return 1;
+
+		if (Cores[i].IRQEnable)
+		{
+			// Input, output and write-back areas are all touched every tick.
+			if (Cores[i].IRQA < SPU2_DYN_MEMLINE)
+				return 1;
+
+			for (int c = 0; c < 2; c++)
+			{
+				if (Cores[c].EffectsStartA < Cores[c].EffectsEndA &&
+					Cores[i].IRQA >= (Cores[c].EffectsStartA & 0x3FFFFF) &&
+					Cores[i].IRQA <= ((Cores[c].EffectsEndA & 0x3FFFFF) | 0xFFFF))
+					return 1;
+			}
+		}
+	}
+
+	// Which leaves the voices, which spu2CanMixBlock() checks for us.  That isn't cheap with a lot
+	// of voices, so when they're too close together, leave them be for a block before looking again.
+	if (s_idle_voice_backoff > 0)
+	{
+		s_idle_voice_backoff--;
+		return 1;
+	}
+
+	if (spu2CanMixBlock(SPU2_MIX_BLOCK_SIZE))
+		return SPU2_MIX_BLOCK_SIZE;
+
+	s_idle_voice_backoff = SPU2_MIX_BLOCK_SIZE;
+	return 1;
+}
+
 __forceinline void TimeUpdate(u32 cClocks)
 {
 	u32 dClocks = cClocks - lClocks;
@@ -277,6 +326,10 @@ __forceinline void TimeUpdate(u32 cClocks)
 		lClocks = cClocks - dClocks;
 	}
 
+	// Voices mixed ahead by spu2MixVoicesBlock(), all of which are used up before we return.
+	u32 block_pos = 0;
+	u32 block_size = 0;
+
 	//Update Mixing Progress
 	while (dClocks >= TickInterval)
 	{
@@ -298,14 +351,38 @@ __forceinline void TimeUpdate(u32 cClocks)
 		lClocks += TickInterval;
 		Cycles++;
 
+		if (block_pos < block_size)
+		{
+			spu2MixBlockSample(block_pos++);
+			continue;
+		}
+
 		// Start Queued Voices, they start after 2T (Tested on real HW)
-		for(int c = 0; c < 2; c++)
+		for (int c = 0; c < 2; c++)
+		{
+			if (Cores[c].KeyOn == 0)
+				continue;
+
 			for (int v = 0; v < 24; v++)
 				if(Cores[c].KeyOn & (1 << v))
 					if(StartQueuedVoice(c, v))
 						Cores[c].KeyOn &= ~(1 << v);
+		}
 
-		spu2Mix();
+		// Nothing outside the mixer can run until we return, so if the voices can't be interrupted
+		// either, mix them for the rest of this update in one go.
+		const u32 ticks = std::min(dClocks / TickInterval + 1, SPU2_MIX_BLOCK_SIZE);
+		if (ticks >= MinBlockTicks && spu2CanMixBlock(ticks))
+		{
+			spu2MixVoicesBlock(ticks);
+			block_size = ticks;
+			block_pos = 0;
+			spu2MixBlockSample(block_pos++);
+		}
+		else
+		{
+			spu2Mix();
+		}
 	}
 
 	//Update DMA4 interrupt delay counter
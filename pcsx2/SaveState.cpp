@@ -39,7 +39,9 @@
 #include "fmt/core.h"
 
 #include <csetjmp>
+#include <mutex>
 #include <png.h>
+#include <unordered_map>
 
 using namespace R5900;
 
@@ -73,6 +75,7 @@ static void PostLoadPrep()
 			MapTLB(tlb[i], i);
 		}
 	}
+	vtlb_UpdateCacheMap();
 
 	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
 	CBreakPoints::SetSkipFirst(BREAKPOINT_EE, 0);
@@ -982,6 +985,28 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 	return true;
 }
 
+// --------------------------------------------------------------------------------------
+//  Save State Index
+// --------------------------------------------------------------------------------------
+// Keyed by the full path, which already includes the game serial and CRC.
+static std::mutex s_index_mutex;
+static std::unordered_map<std::string, SaveStateFileInfo> s_index;
+
+static void SaveState_UpdateIndex(const char* filename, std::unique_ptr<SaveStateScreenshotData> screenshot)
+{
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(filename, &sd))
+		return;
+
+	SaveStateFileInfo info;
+	info.modification_time = sd.ModificationTime;
+	info.size = sd.Size;
+	info.screenshot = std::move(screenshot);
+
+	std::unique_lock lock(s_index_mutex);
+	s_index[filename] = std::move(info);
+}
+
 bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot, const char* filename)
 {
 	zip_error_t ze = {};
@@ -1006,6 +1031,8 @@ bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_
 
 	// force the zip to close, this is the expensive part with libzip.
 	zip_close(zf);
+
+	SaveState_UpdateIndex(filename, std::move(screenshot));
 	return true;
 }
 
@@ -1022,6 +1049,46 @@ bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32*
 	return SaveState_ReadScreenshot(zf.get(), out_width, out_height, out_pixels);
 }
 
+bool SaveState_GetFileInfo(const std::string& filename, SaveStateFileInfo* info)
+{
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(filename.c_str(), &sd))
+	{
+		std::unique_lock lock(s_index_mutex);
+		s_index.erase(filename);
+		return false;
+	}
+
+	{
+		std::unique_lock lock(s_index_mutex);
+		const auto it = s_index.find(filename);
+		if (it != s_index.end() && it->second.modification_time == sd.ModificationTime && it->second.size == sd.Size)
+		{
+			*info = it->second;
+			return true;
+		}
+	}
+
+	// Not seen this version of the file yet, or it was replaced behind our back.
+	info->modification_time = sd.ModificationTime;
+	info->size = sd.Size;
+	info->screenshot.reset();
+
+	std::unique_ptr<SaveStateScreenshotData> screenshot = std::make_unique<SaveStateScreenshotData>();
+	if (SaveState_ReadScreenshot(filename, &screenshot->width, &screenshot->height, &screenshot->pixels))
+		info->screenshot = std::move(screenshot);
+
+	std::unique_lock lock(s_index_mutex);
+	s_index[filename] = *info;
+	return true;
+}
+
+void SaveState_ClearIndex()
+{
+	std::unique_lock lock(s_index_mutex);
+	s_index.clear();
+}
+
 static bool CheckVersion(const std::string& filename, zip_t* zf, Error* error)
 {
 	u32 savever;
@@ -47,6 +47,15 @@ struct SaveStateScreenshotData
 	std::vector<u32> pixels;
 };
 
+// Details of a save state file, as kept in the save state index.
+// The screenshot is already decoded to RGBA8, and is null if the state doesn't have one.
+struct SaveStateFileInfo
+{
+	s64 modification_time;
+	s64 size;
+	std::shared_ptr<const SaveStateScreenshotData> screenshot;
+};
+
 class ArchiveEntryList;
 
 // Wrappers to generate a save state compatible across all frontends.
@@ -55,6 +64,13 @@ extern std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error);
 extern std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot();
 extern bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot, const char* filename);
 extern bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels);
+
+// Save state index, which remembers the timestamp, size and screenshot of state files as they're written
+// or first read, so they don't need to be unzipped and decoded again. Safe to call from any thread, but
+// it still has to stat the file, and falls back to reading the zip when it's changed, so keep it off the
+// CPU/GS threads where possible.
+extern bool SaveState_GetFileInfo(const std::string& filename, SaveStateFileInfo* info);
+extern void SaveState_ClearIndex();
 extern bool SaveState_UnzipFromDisk(const std::string& filename, Error* error);
 
 // --------------------------------------------------------------------------------------
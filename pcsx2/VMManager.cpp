@@ -47,6 +47,8 @@
 #include "common/Error.h"
 #include "common/FileSystem.h"
 #include "common/FPControl.h"
+#include "common/Path.h"
+#include "common/Perf.h"
 #include "common/ScopedGuard.h"
 #include "common/SettingsWrapper.h"
 #include "common/SmallString.h"
@@ -58,6 +60,7 @@
 #include "IconsPromptFont.h"
 #include "cpuinfo.h"
 #include "discord_rpc.h"
+#include "fmt/chrono.h"
 #include "fmt/core.h"
 
 #include <atomic>
@@ -111,6 +114,9 @@ namespace VMManager
 	static bool HasBootedELF();
 	static bool HasValidOrInitializingVM();
 	static void PrecacheCDVDFile();
+	static std::string GetVIFUnpackCachePath(const std::string& serial);
+	static void LoadVIFUnpackCache(const std::string& serial);
+	static void SaveVIFUnpackCache(const std::string& serial);
 
 	static std::string GetCurrentSaveStateFileName(s32 slot);
 	static bool DoLoadState(const char* filename);
@@ -152,6 +158,7 @@ static std::unique_ptr<INISettingsInterface> s_input_settings_interface;
 
 static bool s_log_block_system_console = false;
 static bool s_log_force_file_log = false;
+static bool s_use_constant_rtc = false;
 
 static std::atomic<VMState> s_state{VMState::Shutdown};
 static bool s_cpu_implementation_changed = false;
@@ -460,6 +467,16 @@ void VMManager::Internal::SetBlockSystemConsole(bool block)
 	s_log_block_system_console = block;
 }
 
+void VMManager::Internal::SetUseConstantRTC(bool enabled)
+{
+	s_use_constant_rtc = enabled;
+}
+
+bool VMManager::Internal::IsUsingConstantRTC()
+{
+	return s_use_constant_rtc;
+}
+
 void VMManager::UpdateLoggingSettings(SettingsInterface& si)
 {
 #ifdef _DEBUG
@@ -1030,6 +1047,8 @@ void VMManager::UpdateDiscDetails(bool booting)
 		}
 
 		SaveSessionTime(old_serial);
+		if (!booting)
+			SaveVIFUnpackCache(old_serial);
 
 		s_title_en_search.clear();
 		s_title_en_replace.clear();
@@ -1253,6 +1272,40 @@ void VMManager::PrecacheCDVDFile()
 	}
 }
 
+std::string VMManager::GetVIFUnpackCachePath(const std::string& serial)
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("vifunpack_{}.bin", Path::SanitizeFileName(serial)));
+}
+
+void VMManager::LoadVIFUnpackCache(const std::string& serial)
+{
+	if (!newVifDynaRec || serial.empty() || GSDumpReplayer::IsReplayingDump())
+		return;
+
+	const std::string path = GetVIFUnpackCachePath(serial);
+	if (!FileSystem::FileExists(path.c_str()))
+		return;
+
+	if (THREAD_VU1)
+		vu1Thread.WaitVU();
+
+	if (!dVifLoadCache(path.c_str()))
+		Console.Warning(fmt::format("Failed to load VIF unpack cache from '{}'.", path));
+}
+
+void VMManager::SaveVIFUnpackCache(const std::string& serial)
+{
+	if (!newVifDynaRec || serial.empty() || GSDumpReplayer::IsReplayingDump())
+		return;
+
+	if (THREAD_VU1)
+		vu1Thread.WaitVU();
+
+	const std::string path = GetVIFUnpackCachePath(serial);
+	if (!dVifSaveCache(path.c_str()))
+		Console.Warning(fmt::format("Failed to save VIF unpack cache to '{}'.", path));
+}
+
 bool VMManager::Initialize(VMBootParameters boot_params)
 {
 	const Common::Timer init_timer;
@@ -1552,6 +1605,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 		PrecacheCDVDFile();
 
 	hwReset();
+	LoadVIFUnpackCache(s_disc_serial);
 
 	Console.WriteLn("VM subsystems initialized in %.2f ms", init_timer.GetTimeMilliseconds());
 	s_state.store(VMState::Paused, std::memory_order_release);
@@ -1599,6 +1653,10 @@ void VMManager::Shutdown(bool save_resume_state)
 	if (g_InputRecording.isActive())
 		g_InputRecording.stop();
 
+	// profile is named after the serial, so write it out before the disc details go away
+	SetJITProfilerActive(false);
+	SaveVIFUnpackCache(s_disc_serial);
+
 	SaveSessionTime(s_disc_serial);
 	s_elf_override = {};
 	ClearELFInfo();
@@ -1703,6 +1761,7 @@ void VMManager::Reset()
 	SysMemory::Reset();
 	cpuReset();
 	hwReset();
+	LoadVIFUnpackCache(s_disc_serial);
 
 	if (g_InputRecording.isActive())
 	{
@@ -2056,6 +2115,55 @@ void VMManager::SetLimiterMode(LimiterModeType type)
 	UpdateTargetSpeed();
 }
 
+bool VMManager::IsJITProfilerActive()
+{
+	return Perf::Sampler::IsActive();
+}
+
+void VMManager::SetJITProfilerActive(bool active)
+{
+	// 1ms is frequent enough to find hot blocks within a few seconds, without being noticeable.
+	static constexpr u32 SAMPLE_INTERVAL_US = 1000;
+
+	if (Perf::Sampler::IsActive() == active)
+		return;
+
+	if (active)
+	{
+		if (!Perf::Sampler::Start(SAMPLE_INTERVAL_US))
+		{
+			Host::AddIconOSDMessage("JITProfiler", ICON_FA_EXCLAMATION_TRIANGLE,
+				TRANSLATE_STR("VMManager", "The JIT profiler is not supported on this platform."),
+				Host::OSD_ERROR_DURATION);
+			return;
+		}
+
+		// Code compiled before now was never registered with the sampler, so start over with empty caches.
+		Internal::ClearCPUExecutionCaches();
+		Host::AddIconOSDMessage("JITProfiler", ICON_FA_STOPWATCH, TRANSLATE_STR("VMManager", "JIT profiler started."),
+			Host::OSD_QUICK_DURATION);
+		return;
+	}
+
+	Perf::Sampler::Stop();
+
+	const std::string path = Path::Combine(EmuFolders::Logs,
+		fmt::format("jitprofile_{}_{:%Y%m%d_%H%M%S}.txt", s_disc_serial.empty() ? "unknown" : s_disc_serial,
+			fmt::localtime(std::time(nullptr))));
+	if (Perf::Sampler::ExportReport(path.c_str()))
+	{
+		Host::AddIconOSDMessage("JITProfiler", ICON_FA_STOPWATCH,
+			fmt::format(TRANSLATE_FS("VMManager", "JIT profile saved to '{}'."), Path::GetFileName(path)),
+			Host::OSD_INFO_DURATION);
+	}
+	else
+	{
+		Host::AddIconOSDMessage("JITProfiler", ICON_FA_EXCLAMATION_TRIANGLE,
+			fmt::format(TRANSLATE_FS("VMManager", "Failed to save JIT profile to '{}'."), Path::GetFileName(path)),
+			Host::OSD_ERROR_DURATION);
+	}
+}
+
 float VMManager::GetTargetSpeed()
 {
 	return s_target_speed;
@@ -2823,8 +2931,13 @@ void VMManager::CheckForCPUConfigChanges(const Pcsx2Config& old_config)
 	Internal::ClearCPUExecutionCaches();
 	memBindConditionalHandlers();
 
-	if (EmuConfig.Cpu.Recompiler.EnableFastmem != old_config.Cpu.Recompiler.EnableFastmem)
+	// Fastmem is also turned off while the data cache is emulated.
+	if (EmuConfig.Cpu.Recompiler.EnableFastmem != old_config.Cpu.Recompiler.EnableFastmem ||
+		EmuConfig.Cpu.Recompiler.EnableEECache != old_config.Cpu.Recompiler.EnableEECache ||
+		EmuConfig.Gamefixes.EECacheHack != old_config.Gamefixes.EECacheHack)
+	{
 		vtlb_ResetFastmem();
+	}
 
 	// did we toggle recompilers?
 	if (EmuConfig.Cpu.CpusChanged(old_config.Cpu))
@@ -149,6 +149,12 @@ namespace VMManager
 	/// Updates the host vsync state, as well as timer frequencies. Call when the speed limiter is adjusted.
 	void SetLimiterMode(LimiterModeType type);
 
+	/// Returns true if the JIT sampling profiler is running.
+	bool IsJITProfilerActive();
+
+	/// Starts or stops the JIT sampling profiler. Stopping writes the profile to the logs directory.
+	void SetJITProfilerActive(bool active);
+
 	/// Returns the target speed, based on the limiter mode.
 	float GetTargetSpeed();
 
@@ -245,6 +251,10 @@ namespace VMManager
 		/// Prevents the system console from being displayed.
 		void SetBlockSystemConsole(bool block);
 
+		/// Forces the CDVD real-time clock to a fixed date on boot, for runs which need to be reproducible.
+		void SetUseConstantRTC(bool enabled);
+		bool IsUsingConstantRTC();
+
 		/// Initializes common host state, called on the CPU thread.
 		bool CPUThreadInitialize();
 
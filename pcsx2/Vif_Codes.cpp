@@ -307,6 +307,24 @@ vifOp(vifCode_Mark)
 	return 1;
 }
 
+// Uploads which match the resident microcode are skipped, since clearing the recompiler drops every quick
+// program reference and forces the next execution to search the program cache again. A different program
+// almost always differs within the first few instructions, so the compare costs little when it fails; only
+// an upload which changes nothing but its tail pays for a full compare on top of the copy.
+static __fi void vifWriteMicroMem(int idx, u32 addr, const u32* data, u32 size)
+{
+	VURegs& VUx = idx ? VU1 : VU0;
+	if (std::memcmp(VUx.Micro + addr, data, size) == 0)
+		return;
+
+	if (!idx)
+		CpuVU0->Clear(addr, size);
+	else
+		CpuVU1->Clear(addr, size);
+
+	std::memcpy(VUx.Micro + addr, data, size);
+}
+
 static __fi void _vifCode_MPG(int idx, u32 addr, const u32* data, int size)
 {
 	VURegs& VUx = idx ? VU1 : VU0;
@@ -338,29 +356,16 @@ static __fi void _vifCode_MPG(int idx, u32 addr, const u32* data, int size)
 	if ((addr + size * 4) > vuMemSize)
 	{
 		//DevCon.Warning("Handling split MPG");
-		if (!idx)
-			CpuVU0->Clear(addr, vuMemSize - addr);
-		else
-			CpuVU1->Clear(addr, vuMemSize - addr);
-
-		memcpy(VUx.Micro + addr, data, vuMemSize - addr);
+		vifWriteMicroMem(idx, addr, data, vuMemSize - addr);
 		size -= (vuMemSize - addr) / 4;
 		data += (vuMemSize - addr) / 4;
-		memcpy(VUx.Micro, data, size * 4);
+		vifWriteMicroMem(idx, 0, data, size * 4);
 
 		vifX.tag.addr = size * 4;
 	}
 	else
 	{
-		//The compare is pretty much a waste of time, likelyhood is that the program isnt there, thats why its copying it.
-		//Faster without.
-		//if (memcmp(VUx.Micro + addr, data, size*4)) {
-		// Clear VU memory before writing!
-		if (!idx)
-			CpuVU0->Clear(addr, size * 4);
-		else
-			CpuVU1->Clear(addr, size * 4);
-		memcpy(VUx.Micro + addr, data, size * 4); //from tests, memcpy is 1fps faster on Grandia 3 than memcpy
+		vifWriteMicroMem(idx, addr, data, size * 4);
 
 		vifX.tag.addr += size * 4;
 	}
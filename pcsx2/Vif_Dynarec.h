@@ -13,6 +13,9 @@ typedef void (*nVifrecCall)(uptr dest, uptr src);
 extern void _nVifUnpack(int idx, const u8* data, uint mode, bool isFill);
 extern void dVifReset(int idx);
 extern void dVifRelease(int idx);
+extern void dVifPrecompile(int idx, nVifBlock block);
+extern bool dVifSaveCache(const char* path);
+extern bool dVifLoadCache(const char* path);
 extern void VifUnpackSSE_Init();
 
 _vifT extern void dVifUnpack(const u8* data, bool isFill);
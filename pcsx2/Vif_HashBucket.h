@@ -3,12 +3,17 @@
 
 #pragma once
 
-#include <array>
-#include "fmt/core.h"
+#include "GS/GSVector.h"
+
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
+#include "fmt/core.h"
 
-// nVifBlock - Ordered for Hashing; the 'num' and 'upkType' fields are
-//             used as the hash bucket selector.
+#include <bit>
+#include <cstring>
+
+// nVifBlock - Ordered for Hashing; hash_key/key0/key1 overlay the fields
+//             which identify an unpack routine.
 union nVifBlock
 {
 	// Warning: order depends on the newVifDynaRec code
@@ -36,101 +41,166 @@ union nVifBlock
 
 }; // 16 bytes
 
-// 0x4000 is enough but 0x10000 allow
-// * to skip the compare value of the first double world in lookup
-// * to use a 16 bits move instead of an 'and' mask to compute the hashed key
-#define hSize 0x10000 // [usn*1:mask*1:upk*4:num*8] hash...
-
-// HashBucket is a container which uses a built-in hash function
-// to perform quick searches. It is designed around the nVifBlock structure
+// HashBucket is an open-addressed cache of compiled unpack routines, keyed on the
+// hash_key/key0/key1 words of nVifBlock.
 //
-// The hash function is determined by taking the first bytes of data and
-// performing a modulus the size of hSize. So the most diverse-data should
-// be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
+// Slots are arranged in groups of four, with each key word stored in its own array,
+// so one group (a single cache line) is compared against the search key with three
+// 128-bit compares. Probing is linear over groups and stops at the first group with
+// a free slot, since slots are only ever emptied by a full reset. Once the probe
+// window is full, the least recently used routine in it is replaced; its code is
+// left in the recompiler cache until the next reset.
 class HashBucket
 {
 protected:
-	std::array<nVifBlock*, hSize> m_bucket;
+	static constexpr u32 GROUP_SIZE = 4;
+	static constexpr u32 NUM_GROUPS = 1024;
+	static constexpr u32 MAX_PROBES = 4;
+	static constexpr u32 EMPTY_KEY = 0xFFFFFFFFu; // hash_key is 16 bits wide, so never matches
 
-public:
-	HashBucket()
+	struct alignas(64) Group
 	{
-		m_bucket.fill(nullptr);
+		u32 hash_key[GROUP_SIZE];
+		u32 key0[GROUP_SIZE];
+		u32 key1[GROUP_SIZE];
+		u32 last_use[GROUP_SIZE];
+	};
+	static_assert(sizeof(Group) == 64);
+
+	Group* m_groups = nullptr;
+	nVifBlock* m_blocks = nullptr;
+	u32 m_clock = 0;
+
+	u64 m_hits = 0;
+	u64 m_misses = 0;
+	u64 m_evictions = 0;
+
+	static __fi u32 home_group(const nVifBlock& dataPtr)
+	{
+		// hash_key alone ([usn:mask:upk:num]) is shared by every routine that only differs in mask or cycle.
+		const u32 h = (dataPtr.hash_key * 0x9E3779B1u) ^ (dataPtr.key0 * 0x85EBCA77u) ^ (dataPtr.key1 * 0xC2B2AE3Du);
+		return (h ^ (h >> 16)) & (NUM_GROUPS - 1);
+	}
+
+	void insert(u32 group, u32 slot, const nVifBlock& dataPtr)
+	{
+		Group& g = m_groups[group];
+		g.hash_key[slot] = dataPtr.hash_key;
+		g.key0[slot] = dataPtr.key0;
+		g.key1[slot] = dataPtr.key1;
+		g.last_use[slot] = ++m_clock;
+		m_blocks[group * GROUP_SIZE + slot] = dataPtr;
 	}
 
+public:
+	HashBucket() = default;
 	~HashBucket() { clear(); }
 
 	__fi nVifBlock* find(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		const GSVector4i hash_key(static_cast<int>(dataPtr.hash_key));
+		const GSVector4i key0(static_cast<int>(dataPtr.key0));
+		const GSVector4i key1(static_cast<int>(dataPtr.key1));
+		const GSVector4i empty(GSVector4i::xffffffff());
 
-		while (true)
+		u32 group = home_group(dataPtr);
+		for (u32 probe = 0; probe < MAX_PROBES; probe++, group = (group + 1) & (NUM_GROUPS - 1))
 		{
-			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
-				return chainpos;
-
-			if (chainpos->startPtr == 0)
-				return nullptr;
+			Group& g = m_groups[group];
+			const GSVector4i hash = GSVector4i::load<true>(g.hash_key);
+			const int match = (hash.eq32(hash_key) & GSVector4i::load<true>(g.key0).eq32(key0) &
+							   GSVector4i::load<true>(g.key1).eq32(key1)).mask();
+			if (match != 0)
+			{
+				const u32 slot = static_cast<u32>(std::countr_zero(static_cast<u32>(match))) / 4;
+				g.last_use[slot] = ++m_clock;
+				m_hits++;
+				return &m_blocks[group * GROUP_SIZE + slot];
+			}
 
-			chainpos++;
+			if (hash.eq32(empty).mask() != 0)
+				break;
 		}
+
+		m_misses++;
+		return nullptr;
 	}
 
 	void add(const nVifBlock& dataPtr)
 	{
-		u32 b = dataPtr.hash_key;
-
-		u32 size = bucket_size(dataPtr);
+		u32 group = home_group(dataPtr);
+		u32 victim_group = group;
+		u32 victim_slot = 0;
+		u32 victim_age = 0;
 
-		// Warning there is an extra +1 due to the empty cell
-		// Performance note: 64B align to reduce cache miss penalty in `find`
-		if ((m_bucket[b] = (nVifBlock*)pcsx2_aligned_realloc(m_bucket[b], sizeof(nVifBlock) * (size + 2), 64, sizeof(nVifBlock) * (size + 1))) == NULL)
+		for (u32 probe = 0; probe < MAX_PROBES; probe++, group = (group + 1) & (NUM_GROUPS - 1))
 		{
-			pxFailRel("Failed to allocate HashBucket Chain");
+			const Group& g = m_groups[group];
+			for (u32 slot = 0; slot < GROUP_SIZE; slot++)
+			{
+				if (g.hash_key[slot] == EMPTY_KEY)
+				{
+					insert(group, slot, dataPtr);
+					return;
+				}
+
+				// Wraps safely, the clock only ever moves forward.
+				const u32 age = m_clock - g.last_use[slot];
+				if (age > victim_age)
+				{
+					victim_group = group;
+					victim_slot = slot;
+					victim_age = age;
+				}
+			}
 		}
 
-		// Replace the empty cell by the new block and create a new empty cell
-		memcpy(&m_bucket[b][size++], &dataPtr, sizeof(nVifBlock));
-		memset(&m_bucket[b][size], 0, sizeof(nVifBlock));
-
-		if (size > 3)
-			DevCon.Warning("recVifUnpk: Bucket 0x%04x has %d micro-programs", b, size);
+		m_evictions++;
+		insert(victim_group, victim_slot, dataPtr);
 	}
 
-	u32 bucket_size(const nVifBlock& dataPtr)
+	/// Calls fn for every routine currently in the cache.
+	template <typename F>
+	void for_each(F fn) const
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
-
-		u32 size = 0;
+		if (!m_groups)
+			return;
 
-		while (chainpos->startPtr != 0)
+		for (u32 group = 0; group < NUM_GROUPS; group++)
 		{
-			size++;
-			chainpos++;
+			for (u32 slot = 0; slot < GROUP_SIZE; slot++)
+			{
+				if (m_groups[group].hash_key[slot] != EMPTY_KEY)
+					fn(m_blocks[group * GROUP_SIZE + slot]);
+			}
 		}
-
-		return size;
 	}
 
 	void clear()
 	{
-		for (auto& bucket : m_bucket)
-			safe_aligned_free(bucket);
+		if (m_hits != 0 || m_misses != 0)
+		{
+			DevCon.WriteLn(fmt::format("recVifUnpk: {} hits, {} misses, {} evictions", m_hits, m_misses, m_evictions));
+			m_hits = 0;
+			m_misses = 0;
+			m_evictions = 0;
+		}
+
+		safe_aligned_free(m_groups);
+		safe_aligned_free(m_blocks);
 	}
 
 	void reset()
 	{
 		clear();
 
-		// Allocate an empty cell for all buckets
-		for (auto& bucket : m_bucket)
-		{
-			if ((bucket = (nVifBlock*)_aligned_malloc(sizeof(nVifBlock), 16)) == nullptr)
-			{
-				pxFailRel("Failed to allocate HashBucket Chain on reset");
-			}
+		m_groups = static_cast<Group*>(_aligned_malloc(sizeof(Group) * NUM_GROUPS, alignof(Group)));
+		m_blocks = static_cast<nVifBlock*>(_aligned_malloc(sizeof(nVifBlock) * NUM_GROUPS * GROUP_SIZE, 64));
+		if (!m_groups || !m_blocks)
+			pxFailRel("Failed to allocate HashBucket");
 
-			memset(bucket, 0, sizeof(nVifBlock));
-		}
+		// Only the key arrays need to be marked empty, last_use is written on insert.
+		std::memset(m_groups, 0xFF, sizeof(Group) * NUM_GROUPS);
+		m_clock = 0;
 	}
 };
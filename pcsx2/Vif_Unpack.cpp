@@ -7,6 +7,10 @@
 #include "Vif_Dynarec.h"
 #include "MTVU.h"
 
+#include "common/FileSystem.h"
+
+#include <vector>
+
 enum UnpackOffset {
 	OFFSET_X = 0,
 	OFFSET_Y = 1,
@@ -315,6 +319,84 @@ void releaseNewVif(int idx)
 {
 }
 
+// Only the routine keys are stored. The generated code refers to the VIF state by
+// absolute address and is quick to rebuild, it's the recompiles in the middle of the
+// first frames that hurt, so loading compiles everything up front.
+struct VifCacheHeader
+{
+	u32 magic;
+	u32 version;
+	u32 count;
+};
+
+struct VifCacheEntry
+{
+	u16 hash_key;
+	u16 idx;
+	u32 key0;
+	u32 key1;
+};
+
+static constexpr u32 VIF_CACHE_MAGIC = 0x4B505556; // VUPK
+static constexpr u32 VIF_CACHE_VERSION = 1;
+static constexpr u32 VIF_CACHE_MAX_ENTRIES = 0x10000;
+
+bool dVifSaveCache(const char* path)
+{
+	std::vector<VifCacheEntry> entries;
+	for (u32 idx = 0; idx < 2; idx++)
+	{
+		nVif[idx].vifBlocks.for_each([&entries, idx](const nVifBlock& block) {
+			entries.push_back(VifCacheEntry{block.hash_key, static_cast<u16>(idx), block.key0, block.key1});
+		});
+	}
+
+	if (entries.empty())
+		return true;
+
+	auto fp = FileSystem::OpenManagedCFile(path, "wb");
+	if (!fp)
+		return false;
+
+	const VifCacheHeader header = {VIF_CACHE_MAGIC, VIF_CACHE_VERSION, static_cast<u32>(entries.size())};
+	return (std::fwrite(&header, sizeof(header), 1, fp.get()) == 1 &&
+			std::fwrite(entries.data(), sizeof(VifCacheEntry), entries.size(), fp.get()) == entries.size());
+}
+
+bool dVifLoadCache(const char* path)
+{
+	auto fp = FileSystem::OpenManagedCFile(path, "rb");
+	if (!fp)
+		return false;
+
+	VifCacheHeader header;
+	if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 || header.magic != VIF_CACHE_MAGIC ||
+		header.version != VIF_CACHE_VERSION || header.count > VIF_CACHE_MAX_ENTRIES)
+	{
+		return false;
+	}
+
+	std::vector<VifCacheEntry> entries(header.count);
+	if (std::fread(entries.data(), sizeof(VifCacheEntry), entries.size(), fp.get()) != entries.size())
+		return false;
+
+	for (const VifCacheEntry& entry : entries)
+	{
+		// Unpack formats 3, 7 and 11 don't exist, so nothing would have compiled them.
+		const u32 upk = (entry.hash_key >> 8) & 0xf;
+		if (entry.idx > 1 || ((upk & 3) == 3 && upk != 15))
+			continue;
+
+		nVifBlock block = {};
+		block.hash_key = entry.hash_key;
+		block.key0 = entry.key0;
+		block.key1 = entry.key1;
+		dVifPrecompile(entry.idx, block);
+	}
+
+	return true;
+}
+
 static __fi u8* getVUptr(uint idx, int offset)
 {
 	return (u8*)(vuRegs[idx].Mem + (offset & (idx ? 0x3ff0 : 0xff0)));
@@ -496,6 +496,19 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 	return &block;
 }
 
+void dVifPrecompile(int idx, nVifBlock block)
+{
+	if (nVif[idx].vifBlocks.find(block))
+		return;
+
+	const int wl = block.wl ? block.wl : 256;
+	const bool isFill = (block.cl < wl);
+	if (idx)
+		dVifCompile<1>(block, isFill);
+	else
+		dVifCompile<0>(block, isFill);
+}
+
 _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 {
 	nVifStruct& v = nVif[idx];
@@ -508,7 +521,7 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 	nVifBlock block;
 
 	// Performance note: initial code was using u8/u16 field of the struct
-	// directly. However reading back the data (as u32) in HashBucket.find
+	// directly. However reading back the data (as u32) in HashBucket::find
 	// leads to various memory stalls. So it is way faster to manually build the data
 	// in u32 (aka x86 register).
 	//
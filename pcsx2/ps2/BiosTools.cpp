@@ -5,6 +5,7 @@
 #include <cstring>
 
 #include "common/FileSystem.h"
+#include "common/HostSys.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
 #include "CDVD/CDVD.h"
@@ -34,6 +35,21 @@ struct romdir
 
 static_assert(sizeof(romdir) == DIRENTRY_SIZE, "romdir struct not packed to 16 bytes");
 
+// --------------------------------------------------------------------------------------
+// BiosRomImage
+// --------------------------------------------------------------------------------------
+// Source image of a BIOS ROM component. Because the EE can write to the ROM area, it is copied
+// into PS2 memory on every reset. Where possible the file is mapped read-only rather than read
+// into a private buffer, so the pages live in the OS file cache and are shared between all
+// instances running the same BIOS, and are only resident while a reset is copying them.
+struct BiosRomImage
+{
+	const u8* data = nullptr;
+	size_t size = 0;
+	void* mapping = nullptr;
+	std::vector<u8> buffer;
+};
+
 u32 BiosVersion;
 u32 BiosChecksum;
 u32 BiosRegion;
@@ -48,7 +64,10 @@ std::string BiosZone;
 std::string BiosSerial;
 std::string BiosPath;
 BiosDebugInformation CurrentBiosInformation;
-std::vector<u8> BiosRom;
+
+static BiosRomImage s_bios_rom;
+static BiosRomImage s_bios_rom1;
+static BiosRomImage s_bios_rom2;
 
 void ReadOSDConfigParames()
 {
@@ -192,12 +211,70 @@ static bool LoadBiosVersion(std::FILE* fp, u32& version, std::string& descriptio
 	return true;
 }
 
-static void ChecksumIt(u32& result, u32 offset, u32 size)
+static void ReleaseRomImage(BiosRomImage& image)
+{
+	if (image.mapping)
+		HostSys::UnmapFile(image.mapping, image.size);
+
+	image = {};
+}
+
+static bool LoadRomImage(BiosRomImage& image, const char* filename, s64 filesize, u32 max_size)
+{
+	ReleaseRomImage(image);
+
+	size_t mapped_size;
+	if (void* mapping = HostSys::MapFileReadOnly(filename, &mapped_size))
+	{
+		image.mapping = mapping;
+		image.data = static_cast<const u8*>(mapping);
+		image.size = mapped_size;
+		return true;
+	}
+
+	// Fall back to a private copy if the file can't be mapped.
+	auto fp = FileSystem::OpenManagedCFile(filename, "rb");
+	if (!fp)
+		return false;
+
+	image.buffer.resize(static_cast<size_t>(std::min<s64>(max_size, filesize)));
+	if (std::fread(image.buffer.data(), image.buffer.size(), 1, fp.get()) != 1)
+	{
+		image.buffer = {};
+		return false;
+	}
+
+	image.data = image.buffer.data();
+	image.size = image.buffer.size();
+	return true;
+}
+
+static void CopyRomImage(const BiosRomImage& image, u8* dest, size_t dest_size)
 {
-	const u8* srcdata = &BiosRom[offset];
-	pxAssume((size & 3) == 0);
-	for (size_t i = 0; i < size / 4; ++i)
-		result ^= reinterpret_cast<const u32*>(srcdata)[i];
+	// Short images are zero padded, matching what the hardware sees past the end of the chip.
+	const size_t copy_size = std::min(image.size, dest_size);
+	if (copy_size > 0)
+		std::memcpy(dest, image.data, copy_size);
+	std::memset(dest + copy_size, 0, dest_size - copy_size);
+}
+
+static void ChecksumIt(u32& result, const BiosRomImage& image, u32 size)
+{
+	const size_t checked_size = std::min<size_t>(image.size, size);
+	for (size_t i = 0; i < (checked_size & ~static_cast<size_t>(3)); i += 4)
+	{
+		u32 word;
+		std::memcpy(&word, image.data + i, sizeof(word));
+		result ^= word;
+	}
+
+	// Past the end of the image is zero, so only a partial trailing word contributes.
+	if (checked_size & 3)
+	{
+		u32 word = 0;
+		std::memcpy(&word, image.data + (checked_size & ~static_cast<size_t>(3)), checked_size & 3);
+		result ^= word;
+	}
 }
 
 // Attempts to load a BIOS rom sub-component, by trying multiple combinations of base
@@ -207,7 +284,7 @@ static void ChecksumIt(u32& result, u32 offset, u32 size)
 // Parameters:
 //   ext - extension of the sub-component to load. Valid options are rom1 and rom2.
 //
-static void LoadExtraRom(const char* ext, u32 offset, u32 size)
+static void LoadExtraRom(const char* ext, BiosRomImage& image, u32 size)
 {
 	// Try first a basic extension concatenation (normally results in something like name.bin.rom1)
 	std::string Bios1(StringUtil::StdStringFromFormat("%s.%s", BiosPath.c_str(), ext));
@@ -224,10 +301,7 @@ static void LoadExtraRom(const char* ext, u32 offset, u32 size)
 		}
 	}
 
-	BiosRom.resize(offset + size);
-
-	auto fp = FileSystem::OpenManagedCFile(Bios1.c_str(), "rb");
-	if (!fp || std::fread(&BiosRom[offset], static_cast<size_t>(std::min<s64>(size, filesize)), 1, fp.get()) != 1)
+	if (!LoadRomImage(image, Bios1.c_str(), filesize, size))
 	{
 		Console.Warning("BIOS Warning: %s could not be read (permission denied?)", ext);
 		return;
@@ -338,13 +412,10 @@ bool LoadBIOS()
 
 	LoadBiosVersion(fp.get(), BiosVersion, BiosDescription, BiosRegion, BiosZone, BiosSerial);
 
-	BiosRom.resize(Ps2MemSize::Rom);
-
-	if (FileSystem::FSeek64(fp.get(), 0, SEEK_SET) ||
-		std::fread(BiosRom.data(), static_cast<size_t>(std::min<s64>(Ps2MemSize::Rom, filesize)), 1, fp.get()) != 1)
-	{
+	ReleaseRomImage(s_bios_rom1);
+	ReleaseRomImage(s_bios_rom2);
+	if (!LoadRomImage(s_bios_rom, path.c_str(), filesize, Ps2MemSize::Rom))
 		return false;
-	}
 
 	// If file is less than 2mb it doesn't have an OSD (Devel consoles)
 	// So skip HLEing OSDSys Param stuff
@@ -354,27 +425,26 @@ bool LoadBIOS()
 		NoOSD = false;
 
 	BiosChecksum = 0;
-	ChecksumIt(BiosChecksum, 0, Ps2MemSize::Rom);
+	ChecksumIt(BiosChecksum, s_bios_rom, Ps2MemSize::Rom);
 	BiosPath = std::move(path);
 
 	//injectIRX("host.irx");	//not fully tested; still buggy
 
-	LoadExtraRom("rom1", Ps2MemSize::Rom, Ps2MemSize::Rom1);
-	LoadExtraRom("rom2", Ps2MemSize::Rom + Ps2MemSize::Rom1, Ps2MemSize::Rom2);
+	LoadExtraRom("rom1", s_bios_rom1, Ps2MemSize::Rom1);
+	LoadExtraRom("rom2", s_bios_rom2, Ps2MemSize::Rom2);
 	return true;
 }
 
 void CopyBIOSToMemory()
 {
-	if (BiosRom.size() >= Ps2MemSize::Rom)
+	if (s_bios_rom.data)
 	{
-		std::memcpy(eeMem->ROM, BiosRom.data(), sizeof(eeMem->ROM));
-		if (BiosRom.size() >= (Ps2MemSize::Rom + Ps2MemSize::Rom1))
-		{
-			std::memcpy(eeMem->ROM1, BiosRom.data() + Ps2MemSize::Rom, sizeof(eeMem->ROM1));
-			if (BiosRom.size() >= (Ps2MemSize::Rom + Ps2MemSize::Rom1 + Ps2MemSize::Rom2))
-				std::memcpy(eeMem->ROM2, BiosRom.data() + Ps2MemSize::Rom + Ps2MemSize::Rom1, sizeof(eeMem->ROM2));
-		}
+		CopyRomImage(s_bios_rom, eeMem->ROM, sizeof(eeMem->ROM));
+		// ROM1 reads as zero when only ROM2 is present.
+		if (s_bios_rom1.data || s_bios_rom2.data)
+			CopyRomImage(s_bios_rom1, eeMem->ROM1, sizeof(eeMem->ROM1));
+		if (s_bios_rom2.data)
+			CopyRomImage(s_bios_rom2, eeMem->ROM2, sizeof(eeMem->ROM2));
 	}
 
 	if (EmuConfig.CurrentIRX.length() > 3)
@@ -106,10 +106,6 @@ extern std::string BiosZone;
 extern std::string BiosSerial;
 extern std::string BiosPath;
 
-// Copies of the BIOS ROM. Because the EE can write to the ROM area, we need to copy it on reset.
-// If we ever support read-only physical mappings, we can remove this.
-extern std::vector<u8> BiosRom;
-
 extern void ReadOSDConfigParames();
 
 extern bool IsBIOS(const char* filename, u32& version, std::string& description, u32& region, std::string& zone);
@@ -33,6 +33,7 @@
 #include <map>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #define FASTMEM_LOG(...)
 //#define FASTMEM_LOG(...) Console.WriteLn(__VA_ARGS__)
@@ -118,38 +119,39 @@ __inline int ConvertPageMask(u32 PageMask)
 	return (1 << (12 + mask)) - 1;
 }
 
-__inline int CheckCache(u32 addr)
+// Pages currently flagged in vtlbdata.cmap, so a rebuild only has to clear what it set last time.
+static std::vector<std::pair<u32, u32>> s_cache_map_ranges;
+
+// Rebuilds the per-page cacheable flags from the DC bit in Config and the cache mode of the TLB entries.
+// Needs to be called whenever either of them changes.
+void vtlb_UpdateCacheMap()
 {
-	u32 mask;
+	for (const auto& [start, end] : s_cache_map_ranges)
+		std::memset(&vtlbdata.cmap[start], 0, end - start);
+	s_cache_map_ranges.clear();
 
 	if (((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0)
-	{
-		//DevCon.Warning("Data Cache Disabled! %x", cpuRegs.CP0.n.Config);
-		return false; //
-	}
+		return;
+
+	const auto mark_range = [](u32 pfn, u32 mask) {
+		const u32 start = pfn >> VTLB_PAGE_BITS;
+		const u32 end = static_cast<u32>(std::min<u64>((static_cast<u64>(pfn) + mask + 1) >> VTLB_PAGE_BITS, VTLB_VMAP_ITEMS));
+		std::memset(&vtlbdata.cmap[start], 1, end - start);
+		s_cache_map_ranges.emplace_back(start, end);
+	};
 
 	for (int i = 1; i < 48; i++)
 	{
 		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3)
-		{
-			mask = ConvertPageMask(tlb[i].PageMask);
-			if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask))
-			{
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0);
-				return true;
-			}
-		}
+			mark_range(tlb[i].PFN1, ConvertPageMask(tlb[i].PageMask));
 		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3)
-		{
-			mask = ConvertPageMask(tlb[i].PageMask);
-			if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask))
-			{
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0);
-				return true;
-			}
-		}
+			mark_range(tlb[i].PFN0, ConvertPageMask(tlb[i].PageMask));
 	}
-	return false;
+}
+
+__inline int CheckCache(u32 addr)
+{
+	return vtlbdata.cmap[addr >> VTLB_PAGE_BITS];
 }
 // --------------------------------------------------------------------------------------
 // Interpreter Implementations of VTLB Memory Operations.
@@ -164,27 +166,24 @@ DataType vtlb_memRead(u32 addr)
 
 	if (!vmv.isHandler(addr))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(addr))
 		{
-			if (CHECK_CACHE && CheckCache(addr))
+			switch (DataSize)
 			{
-				switch (DataSize)
-				{
-					case 8:
-						return readCache8(addr);
-						break;
-					case 16:
-						return readCache16(addr);
-						break;
-					case 32:
-						return readCache32(addr);
-						break;
-					case 64:
-						return readCache64(addr);
-						break;
-
-						jNO_DEFAULT;
-				}
+				case 8:
+					return readCache8(addr);
+					break;
+				case 16:
+					return readCache16(addr);
+					break;
+				case 32:
+					return readCache32(addr);
+					break;
+				case 64:
+					return readCache64(addr);
+					break;
+
+					jNO_DEFAULT;
 			}
 		}
 
@@ -219,12 +218,9 @@ RETURNS_R128 vtlb_memRead128(u32 mem)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(mem))
 		{
-			if (CHECK_CACHE && CheckCache(mem))
-			{
-				return readCache128(mem);
-			}
+			return readCache128(mem);
 		}
 
 		return r128_load(reinterpret_cast<const void*>(vmv.assumePtr(mem)));
@@ -247,25 +243,22 @@ void vtlb_memWrite(u32 addr, DataType data)
 
 	if (!vmv.isHandler(addr))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(addr))
 		{
-			if (CHECK_CACHE && CheckCache(addr))
+			switch (DataSize)
 			{
-				switch (DataSize)
-				{
-					case 8:
-						writeCache8(addr, data);
-						return;
-					case 16:
-						writeCache16(addr, data);
-						return;
-					case 32:
-						writeCache32(addr, data);
-						return;
-					case 64:
-						writeCache64(addr, data);
-						return;
-				}
+				case 8:
+					writeCache8(addr, data);
+					return;
+				case 16:
+					writeCache16(addr, data);
+					return;
+				case 32:
+					writeCache32(addr, data);
+					return;
+				case 64:
+					writeCache64(addr, data);
+					return;
 			}
 		}
 
@@ -286,14 +279,11 @@ void TAKES_R128 vtlb_memWrite128(u32 mem, r128 value)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(mem))
 		{
-			if (CHECK_CACHE && CheckCache(mem))
-			{
-				alignas(16) const u128 r = r128_to_u128(value);
-				writeCache128(mem, &r);
-				return;
-			}
+			alignas(16) const u128 r = r128_to_u128(value);
+			writeCache128(mem, &r);
+			return;
 		}
 
 		r128_store_unaligned((void*)vmv.assumePtr(mem), value);
@@ -569,7 +559,7 @@ static void TAKES_R128 vtlbUnmappedVWriteLg(u32 addr, r128 data) { vtlb_Miss(add
 template <typename OperandType>
 static OperandType vtlbUnmappedPReadSm(u32 addr) {
 	vtlb_BusError(addr, 0);
-	if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)){
+	if(CHECK_CACHE && CheckCache(addr)){
 		switch (sizeof(OperandType)) {
 			case 1: return readCache8(addr, false);
 			case 2: return readCache16(addr, false);
@@ -580,12 +570,12 @@ static OperandType vtlbUnmappedPReadSm(u32 addr) {
 	}
 	return 0;
 }
-static RETURNS_R128 vtlbUnmappedPReadLg(u32 addr) { vtlb_BusError(addr, 0); if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)){ return readCache128(addr, false); } return r128_zero(); }
+static RETURNS_R128 vtlbUnmappedPReadLg(u32 addr) { vtlb_BusError(addr, 0); if(CHECK_CACHE && CheckCache(addr)){ return readCache128(addr, false); } return r128_zero(); }
 
 template <typename OperandType>
 static void vtlbUnmappedPWriteSm(u32 addr, OperandType data) {
 	vtlb_BusError(addr, 1);
-	if (!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) {
+	if (CHECK_CACHE && CheckCache(addr)) {
 		switch (sizeof(OperandType)) {
 			case 1: writeCache8(addr, data, false); break;
 			case 2: writeCache16(addr, data, false); break;
@@ -595,7 +585,7 @@ static void vtlbUnmappedPWriteSm(u32 addr, OperandType data) {
 		}
 	}
 }
-static void TAKES_R128 vtlbUnmappedPWriteLg(u32 addr, r128 data) { vtlb_BusError(addr, 1); if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) { writeCache128(addr, reinterpret_cast<mem128_t*>(&data) /*Safe??*/, false); }}
+static void TAKES_R128 vtlbUnmappedPWriteLg(u32 addr, r128 data) { vtlb_BusError(addr, 1); if(CHECK_CACHE && CheckCache(addr)) { writeCache128(addr, reinterpret_cast<mem128_t*>(&data) /*Safe??*/, false); }}
 // clang-format on
 
 // --------------------------------------------------------------------------------------
@@ -46,6 +46,7 @@ extern void vtlb_Init();
 extern void vtlb_Shutdown();
 extern void vtlb_Reset();
 extern void vtlb_ResetFastmem();
+extern void vtlb_UpdateCacheMap();
 
 extern vtlbHandler vtlb_NewHandler();
 
@@ -195,6 +196,8 @@ namespace vtlb_private
 
 		u32* ppmap;               //4MB (allocated by vtlb_init) // PS2 virtual to PS2 physical
 
+		u8 cmap[VTLB_VMAP_ITEMS]; //1MB // PS2 virtual page is data cacheable, see vtlb_UpdateCacheMap()
+
 		uptr fastmem_base;
 
 		MapData()
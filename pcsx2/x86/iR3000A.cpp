@@ -17,6 +17,7 @@
 #endif
 
 #include "iCore.h"
+#include "iR5900Analysis.h"
 
 #include "Config.h"
 
@@ -154,7 +155,7 @@ static void iopRecRecompile(u32 startpc);
 
 static const void* iopDispatcherEvent = nullptr;
 static const void* iopDispatcherReg = nullptr;
-static const void* iopJITCompile = nullptr;
+const void* iopJITCompile = nullptr;
 static const void* iopJITCompileInBlock = nullptr;
 static const void* iopEnterRecompiledCode = nullptr;
 static const void* iopExitRecompiledCode = nullptr;
@@ -241,6 +242,8 @@ static void _DynGen_Dispatchers()
 	// most and stand to benefit from strong alignment and direct referencing.
 	iopDispatcherEvent = xGetPtr();
 	xFastCall((void*)recEventTest);
+	Perf::any.Register(start, xGetPtr() - start, "IOP Event Test");
+	start = xGetPtr();
 	iopDispatcherReg = _DynGen_DispatcherReg();
 
 	iopJITCompile = _DynGen_JITCompile();
@@ -1664,23 +1667,8 @@ static void iopRecRecompile(const u32 startpc)
 StartRecomp:
 
 	s_nBlockFF = false;
-	if (s_branchTo == startpc)
-	{
-		s_nBlockFF = true;
-		for (i = startpc; i < s_nEndBlock; i += 4)
-		{
-			if (i != s_nEndBlock - 8)
-			{
-				switch (iopMemRead32(i))
-				{
-					case 0: // nop
-						break;
-					default:
-						s_nBlockFF = false;
-				}
-			}
-		}
-	}
+	if (s_branchTo == startpc && EmuConfig.Speedhacks.WaitLoop)
+		s_nBlockFF = R5900::WaitLoopPass::IsWaitLoop(startpc, s_nEndBlock, true, iopMemRead32);
 
 	// rec info //
 	{
@@ -21,6 +21,7 @@ static const int psxInstCycles_Load = 0;
 #define PSX_LO XMMGPR_LO
 
 extern uptr psxRecLUT[];
+extern const void* iopJITCompile;
 
 void _psxFlushConstReg(int reg);
 void _psxFlushConstRegs();
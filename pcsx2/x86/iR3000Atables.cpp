@@ -1073,90 +1073,209 @@ static void rpsxCalcStoreOperand()
 		xMOV(arg2regd, ptr32[&psxRegs.GPR.r[_Rt_]]);
 }
 
+// Calls an IOP memory handler for accesses which miss the RAM fast path. Rather than flushing the
+// register cache, only the live caller-saved registers are spilled around the call.
+static void rpsxCallMemHandler(const void* handler, u32 exclude_mask)
+{
+#ifdef _WIN32
+	static constexpr u32 SHADOW_SIZE = 32;
+#else
+	static constexpr u32 SHADOW_SIZE = 0;
+#endif
+
+	const auto is_live = [exclude_mask](u32 i) {
+		return x86regs[i].inuse && xRegisterBase::IsCallerSaved(i) && !(exclude_mask & (1u << i));
+	};
+
+	u32 num_gprs = 0;
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
+		num_gprs += is_live(i);
+
+	const u32 stack_size = (num_gprs > 0) ? ((((num_gprs + 1) & ~1u) * 8) + SHADOW_SIZE) : 0;
+	if (stack_size > 0)
+	{
+		xSUB(rsp, stack_size);
+
+		u32 stack_offset = SHADOW_SIZE;
+		for (u32 i = 0; i < iREGCNT_GPR; i++)
+		{
+			if (is_live(i))
+			{
+				xMOV(ptr64[rsp + stack_offset], xRegister64(i));
+				stack_offset += 8;
+			}
+		}
+	}
+
+	xFastCall(handler);
+
+	if (stack_size > 0)
+	{
+		u32 stack_offset = SHADOW_SIZE;
+		for (u32 i = 0; i < iREGCNT_GPR; i++)
+		{
+			if (is_live(i))
+			{
+				xMOV(xRegister64(i), ptr64[rsp + stack_offset]);
+				stack_offset += 8;
+			}
+		}
+
+		xADD(rsp, stack_size);
+	}
+}
+
 static void rpsxLoad(int size, bool sign)
 {
 	rpsxCalcAddressOperand();
 
+	int rt = -1;
 	if (_Rt_ != 0)
 	{
 		PSX_DEL_CONST(_Rt_);
-		_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+		rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
 	}
 
-	_psxFlushCall(FLUSH_FULLVTLB);
+	const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
+
+	// RAM reads are done inline, and leave the register cache intact.
 	xTEST(arg1regd, 0x10000000);
-	xForwardJZ8 is_ram_read;
+	xForwardJNZ32 not_ram_read;
+
+	if (_Rt_ != 0)
+	{
+		xMOV(eax, arg1regd);
+		xAND(eax, 0x1fffff);
+
+		const auto addr = xComplexAddress(arg2reg, iopMem->Main, rax);
+		switch (size)
+		{
+			case 8:
+				sign ? xMOVSX(dreg, ptr8[addr]) : xMOVZX(dreg, ptr8[addr]);
+				break;
+			case 16:
+				sign ? xMOVSX(dreg, ptr16[addr]) : xMOVZX(dreg, ptr16[addr]);
+				break;
+			case 32:
+				xMOV(dreg, ptr32[addr]);
+				break;
+
+				jNO_DEFAULT
+		}
+	}
 
+	xForwardJump32 done;
+	not_ram_read.SetTarget();
+
+	// hardware reads can have side effects, so they're done even when the result is discarded
+	const u32 exclude_mask = (rt >= 0) ? (1u << rt) : 0;
 	switch (size)
 	{
 		case 8:
-			xFastCall((void*)iopMemRead8);
+			rpsxCallMemHandler((void*)iopMemRead8, exclude_mask);
 			break;
 		case 16:
-			xFastCall((void*)iopMemRead16);
+			rpsxCallMemHandler((void*)iopMemRead16, exclude_mask);
 			break;
 		case 32:
-			xFastCall((void*)iopMemRead32);
+			rpsxCallMemHandler((void*)iopMemRead32, exclude_mask);
 			break;
 
 			jNO_DEFAULT
 	}
 
-	if (_Rt_ == 0)
+	if (_Rt_ != 0)
 	{
-		// dummy read
-		is_ram_read.SetTarget();
-		return;
+		// sign/zero extend as needed
+		switch (size)
+		{
+			case 8:
+				sign ? xMOVSX(dreg, al) : xMOVZX(dreg, al);
+				break;
+			case 16:
+				sign ? xMOVSX(dreg, ax) : xMOVZX(dreg, ax);
+				break;
+			case 32:
+				if (rt >= 0)
+					xMOV(dreg, eax);
+				break;
+				jNO_DEFAULT
+		}
 	}
 
-	xForwardJump8 done;
-	is_ram_read.SetTarget();
+	done.SetTarget();
+
+	// if not caching, write back
+	if (rt < 0 && _Rt_ != 0)
+		xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
+}
+
+static void rpsxStore(int size)
+{
+	rpsxCalcAddressOperand();
+	rpsxCalcStoreOperand();
 
-	// read from psM directly
-	xAND(arg1regd, 0x1fffff);
+	// Stores to RAM which doesn't contain compiled code can skip the handler. The block check mirrors
+	// the early out in psxRecClearMem(), anything else (including isolated cache) goes through the handler.
+	const int temp = _allocX86reg(X86TYPE_TEMP, 0, 0);
+	const xAddressReg tempq(temp);
 
-	auto addr = xComplexAddress(rax, iopMem->Main, arg1reg);
+	xTEST(arg1regd, 0x1f800000);
+	xForwardJNZ32 not_ram_write;
+	xTEST(ptr32[&psxRegs.CP0.n.Status], 0x10000);
+	xForwardJNZ32 isolated_write;
+
+	xMOV(eax, arg1regd);
+	xAND(eax, 0x1ffffc);
+	xMOV(tempq, ptr64[xComplexAddress(tempq, (void*)psxRecLUT[0], rax * 2)]);
+	xLoadFarAddr(rax, iopJITCompile);
+	xCMP(tempq, rax);
+	xForwardJNE32 has_code;
+
+	xMOV(eax, arg1regd);
+	xAND(eax, 0x1fffff);
+
+	const auto addr = xComplexAddress(tempq, iopMem->Main, rax);
 	switch (size)
 	{
 		case 8:
-			xMOVZX(eax, ptr8[addr]);
+			xMOV(ptr8[addr], xRegister8(arg2regd));
 			break;
 		case 16:
-			xMOVZX(eax, ptr16[addr]);
+			xMOV(ptr16[addr], xRegister16(arg2regd));
 			break;
 		case 32:
-			xMOV(eax, ptr32[addr]);
+			xMOV(ptr32[addr], arg2regd);
 			break;
 
 			jNO_DEFAULT
 	}
 
-	done.SetTarget();
+	xForwardJump32 done;
+	not_ram_write.SetTarget();
+	isolated_write.SetTarget();
+	has_code.SetTarget();
 
-	const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
-	const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
-
-	// sign/zero extend as needed
+	const u32 exclude_mask = 1u << temp;
 	switch (size)
 	{
 		case 8:
-			sign ? xMOVSX(dreg, al) : xMOVZX(dreg, al);
+			rpsxCallMemHandler((void*)iopMemWrite8, exclude_mask);
 			break;
 		case 16:
-			sign ? xMOVSX(dreg, ax) : xMOVZX(dreg, ax);
+			rpsxCallMemHandler((void*)iopMemWrite16, exclude_mask);
 			break;
 		case 32:
-			xMOV(dreg, eax);
+			rpsxCallMemHandler((void*)iopMemWrite32, exclude_mask);
 			break;
+
 			jNO_DEFAULT
 	}
 
-	// if not caching, write back
-	if (rt < 0)
-		xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
+	done.SetTarget();
+	_freeX86reg(temp);
 }
 
-
 REC_FUNC(LWL);
 REC_FUNC(LWR);
 REC_FUNC(SWL);
@@ -1189,18 +1308,12 @@ static void rpsxLW()
 
 static void rpsxSB()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite8);
+	rpsxStore(8);
 }
 
 static void rpsxSH()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite16);
+	rpsxStore(16);
 }
 
 static void rpsxSW()
@@ -1213,10 +1326,7 @@ static void rpsxSW()
 		return;
 	}
 
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite32);
+	rpsxStore(32);
 }
 
 //// SLL
@@ -66,12 +66,16 @@ void LoadBranchState();
 void recompileNextInstruction(bool delayslot, bool swapped_delay_slot);
 void SetBranchReg(u32 reg);
 void SetBranchImm(u32 imm);
+void SetBranchImmOrContinue(u32 imm);
 
 void iFlushCall(int flushtype);
 void recBranchCall(void (*func)());
 void recCall(void (*func)());
 u32 scaleblockcycles_clear();
 
+// Forgets where the last VU0 macro op left Q in a register, so the next one reloads it.
+void mVUresetMacroQ();
+
 namespace R5900
 {
 	namespace Dynarec
@@ -349,6 +349,317 @@ void COP2MicroFinishPass::Run(u32 start, u32 end, EEINST* inst_cache)
 #endif
 }
 
+WaitLoopPass::WaitLoopPass() = default;
+
+WaitLoopPass::~WaitLoopPass() = default;
+
+void WaitLoopPass::Run(u32 start, u32 end, EEINST* inst_cache)
+{
+	// Read through PSM like the block scan, so we don't go through the data cache.
+	m_wait_loop = IsWaitLoop(start, end, false, [](u32 pc) { return *reinterpret_cast<const u32*>(PSM(pc)); });
+}
+
+// GPRs are bits 0-31, HI and LO follow.
+static constexpr u32 WAITLOOP_HI = 32;
+static constexpr u32 WAITLOOP_LO = 33;
+static constexpr u32 WAITLOOP_REGS = 34;
+
+// Returns the registers read and written by an instruction which is allowed in a wait loop, or false if it has
+// side effects (stores, COP writes, exceptions, ...) or touches state we don't track. The R3000A decodes some
+// of the EE-only encodings as something else entirely, so those are rejected for the IOP.
+static bool GetWaitLoopOperands(u32 code, bool iop, u64* reads, u64* writes)
+{
+	const u32 rs = (code >> 21) & 0x1F;
+	const u32 rt = (code >> 16) & 0x1F;
+	const u32 rd = (code >> 11) & 0x1F;
+	const auto reg = [](u32 r) { return static_cast<u64>(1) << r; };
+
+	*reads = 0;
+	*writes = 0;
+
+	switch (code >> 26)
+	{
+		case 000: // SPECIAL
+			switch (code & 0x3F)
+			{
+				case 070: // DSLL
+				case 072: // DSRL
+				case 073: // DSRA
+				case 074: // DSLL32
+				case 076: // DSRL32
+				case 077: // DSRA32
+					if (iop)
+						return false;
+					[[fallthrough]];
+
+				case 000: // SLL
+				case 002: // SRL
+				case 003: // SRA
+					*reads = reg(rt);
+					*writes = reg(rd);
+					return true;
+
+				case 024: // DSLLV
+				case 026: // DSRLV
+				case 027: // DSRAV
+				case 054: // DADD
+				case 055: // DADDU
+				case 056: // DSUB
+				case 057: // DSUBU
+					if (iop)
+						return false;
+					[[fallthrough]];
+
+				case 004: // SLLV
+				case 006: // SRLV
+				case 007: // SRAV
+				case 040: // ADD
+				case 041: // ADDU
+				case 042: // SUB
+				case 043: // SUBU
+				case 044: // AND
+				case 045: // OR
+				case 046: // XOR
+				case 047: // NOR
+				case 052: // SLT
+				case 053: // SLTU
+					*reads = reg(rs) | reg(rt);
+					*writes = reg(rd);
+					return true;
+
+				case 012: // MOVZ
+				case 013: // MOVN
+					if (iop)
+						return false;
+
+					// rd keeps its old value when the condition fails
+					*reads = reg(rs) | reg(rt) | reg(rd);
+					*writes = reg(rd);
+					return true;
+
+				case 020: // MFHI
+					*reads = reg(WAITLOOP_HI);
+					*writes = reg(rd);
+					return true;
+
+				case 022: // MFLO
+					*reads = reg(WAITLOOP_LO);
+					*writes = reg(rd);
+					return true;
+
+				case 021: // MTHI
+					*reads = reg(rs);
+					*writes = reg(WAITLOOP_HI);
+					return true;
+
+				case 023: // MTLO
+					*reads = reg(rs);
+					*writes = reg(WAITLOOP_LO);
+					return true;
+
+				case 030: // MULT
+				case 031: // MULTU
+				case 032: // DIV
+				case 033: // DIVU
+					// rd is only written by the EE's three operand multiplies, and is zero otherwise
+					*reads = reg(rs) | reg(rt);
+					*writes = (iop ? 0 : reg(rd)) | reg(WAITLOOP_HI) | reg(WAITLOOP_LO);
+					return true;
+
+				case 017: // SYNC
+					return !iop;
+
+				default:
+					return false;
+			}
+
+		case 001: // REGIMM
+			// The likely variants (BLTZL, BGEZL, BLTZALL, BGEZALL) are EE-only.
+			if (iop && (rt & 2))
+				return false;
+
+			if (rt < 4) // BLTZ, BGEZ, BLTZL, BGEZL
+			{
+				*reads = reg(rs);
+				return true;
+			}
+			else if (rt >= 16 && rt < 20) // BLTZAL, BGEZAL, BLTZALL, BGEZALL
+			{
+				*reads = reg(rs);
+				*writes = reg(31);
+				return true;
+			}
+			return false;
+
+		case 002: // J
+			return true;
+
+		case 003: // JAL
+			*writes = reg(31);
+			return true;
+
+		case 024: // BEQL
+		case 025: // BNEL
+			if (iop)
+				return false;
+			[[fallthrough]];
+
+		case 004: // BEQ
+		case 005: // BNE
+			*reads = reg(rs) | reg(rt);
+			return true;
+
+		case 026: // BLEZL
+		case 027: // BGTZL
+			if (iop)
+				return false;
+			[[fallthrough]];
+
+		case 006: // BLEZ
+		case 007: // BGTZ
+			*reads = reg(rs);
+			return true;
+
+		case 030: // DADDI
+		case 031: // DADDIU
+			if (iop)
+				return false;
+			[[fallthrough]];
+
+		case 010: // ADDI
+		case 011: // ADDIU
+		case 012: // SLTI
+		case 013: // SLTIU
+		case 014: // ANDI
+		case 015: // ORI
+		case 016: // XORI
+		case 017: // LUI
+			*reads = reg(rs);
+			*writes = reg(rt);
+			return true;
+
+		case 020: // COP0
+		case 021: // COP1
+		case 022: // COP2
+		case 023: // COP3
+			// Only MFC0/CFC0 on the IOP. There's no FPU, COP2 is the GTE, and the condition signals aren't wired.
+			if (iop)
+			{
+				if ((code >> 26) != 020 || (rs != 0 && rs != 2))
+					return false;
+
+				*writes = reg(rt);
+				return true;
+			}
+
+			if (rs < 4) // MFCz, DMFCz/QMFC2, CFCz
+			{
+				*writes = reg(rt);
+				return true;
+			}
+			// BCzF, BCzT, BCzFL, BCzTL only look at the condition signal
+			return (rs == 8);
+
+		case 047: // LWU
+		case 067: // LD
+			if (iop)
+				return false;
+			[[fallthrough]];
+
+		case 040: // LB
+		case 041: // LH
+		case 043: // LW
+		case 044: // LBU
+		case 045: // LHU
+			*reads = reg(rs);
+			*writes = reg(rt);
+			return true;
+
+		case 032: // LDL
+		case 033: // LDR
+			if (iop)
+				return false;
+			[[fallthrough]];
+
+		case 042: // LWL
+		case 046: // LWR
+			// partial loads merge into the old value
+			*reads = reg(rs) | reg(rt);
+			*writes = reg(rt);
+			return true;
+
+		case 057: // CACHE
+		case 063: // PREF
+			if (iop)
+				return false;
+
+			*reads = reg(rs);
+			return true;
+
+		default:
+			// Stores, LQ (FIFO reads pop data), loads to FPR/VU registers, SYSCALL, ...
+			return false;
+	}
+}
+
+bool WaitLoopPass::IsWaitLoop(u32 start, u32 end, bool iop, u32 (*read_code)(u32 pc))
+{
+	// Track which entry values each register depends on at the end of an iteration. Memory and
+	// constants are fine, since the loop only exits when memory (or a hardware register) changes.
+	// A register whose new value depends on its own old value, directly or through other registers,
+	// carries state between iterations (counters, timeouts), so the loop isn't just waiting.
+	u64 deps[WAITLOOP_REGS];
+	for (u32 i = 0; i < WAITLOOP_REGS; i++)
+		deps[i] = static_cast<u64>(1) << i;
+
+	u64 written = 0;
+	for (u32 pc = start; pc < end; pc += 4)
+	{
+		u64 reads, writes;
+		if (!GetWaitLoopOperands(read_code(pc), iop, &reads, &writes))
+			return false;
+
+		u64 value_deps = 0;
+		for (u32 i = 0; i < WAITLOOP_REGS; i++)
+		{
+			if (reads & (static_cast<u64>(1) << i))
+				value_deps |= deps[i];
+		}
+
+		// r0 is never written
+		writes &= ~static_cast<u64>(1);
+		for (u32 i = 0; i < WAITLOOP_REGS; i++)
+		{
+			if (writes & (static_cast<u64>(1) << i))
+				deps[i] = value_deps;
+		}
+		written |= writes;
+	}
+
+	// Only entry values of registers the loop writes can change between iterations. Look for a cycle
+	// between them by closing the dependencies over each other.
+	u64 reach[WAITLOOP_REGS];
+	for (u32 i = 0; i < WAITLOOP_REGS; i++)
+		reach[i] = (written & (static_cast<u64>(1) << i)) ? (deps[i] & written) : 0;
+
+	for (u32 k = 0; k < WAITLOOP_REGS; k++)
+	{
+		for (u32 i = 0; i < WAITLOOP_REGS; i++)
+		{
+			if (reach[i] & (static_cast<u64>(1) << k))
+				reach[i] |= reach[k];
+		}
+	}
+
+	for (u32 i = 0; i < WAITLOOP_REGS; i++)
+	{
+		if (reach[i] & (static_cast<u64>(1) << i))
+			return false;
+	}
+
+	return true;
+}
+
 /////////////////////////////////////////////////////////////////////
 // Back-Prop Function Tables - Gathering Info
 // Note to anyone changing these: writes must go before reads.
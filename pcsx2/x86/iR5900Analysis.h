@@ -59,6 +59,26 @@ namespace R5900
 
 		void Run(u32 start, u32 end, EEINST* inst_cache) override;
 	};
+
+	/// Checks whether a block which branches back to its own start is a wait loop, i.e. it only polls memory or
+	/// hardware registers, and every iteration does the same thing until one of those changes. Such loops can
+	/// skip ahead to the next event instead of spinning.
+	class WaitLoopPass final : public AnalysisPass
+	{
+	public:
+		WaitLoopPass();
+		~WaitLoopPass();
+
+		void Run(u32 start, u32 end, EEINST* inst_cache) override;
+
+		bool IsWaitLoop() const { return m_wait_loop; }
+
+		/// Also used by the IOP recompiler, in which case the EE-only encodings are rejected.
+		static bool IsWaitLoop(u32 start, u32 end, bool iop, u32 (*read_code)(u32 pc));
+
+	private:
+		bool m_wait_loop = false;
+	};
 } // namespace R5900
 
 void recBackpropBSC(u32 code, EEINST* prev, EEINST* pinst);
@@ -21,6 +21,10 @@
 #include "common/HeapArray.h"
 #include "common/Perf.h"
 
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
 // Only for MOVQ workaround.
 #include "common/emitter/internal.h"
 
@@ -91,6 +95,19 @@ u32 s_nEndBlock = 0; // what pc the current block ends
 u32 s_branchTo;
 static bool s_nBlockFF;
 
+// Hot trace superblocks. Blocks which end in a plain conditional branch count how often they run, and
+// once hot they are recompiled with the fall-through path of their branches kept inside the block; the
+// taken paths become side exits. The code stays contiguous, so page protection still covers it.
+static constexpr u32 SUPERBLOCK_MAX_EXITS = 8;
+static constexpr u32 SUPERBLOCK_HOT_THRESHOLD = 1024;
+// Each candidate block gets its own counter, the generated code addresses it directly so it has to stay static.
+alignas(16) static u16 s_superblock_heat[0x4000];
+static std::unordered_map<u32, u32> s_superblock_heat_slots; // physical start -> counter index
+static std::unordered_set<u32> s_superblock_hot;
+static std::map<u32, u32> s_superblock_ranges; // physical start -> end
+static u32 s_superblock_exits[SUPERBLOCK_MAX_EXITS]; // delay slot pc of each side exit
+static u32 s_nSuperblockExits = 0;
+
 // save states for branches
 GPR_reg64 s_saveConstRegs[32];
 static u32 s_saveHasConstReg = 0, s_saveFlushedConstReg = 0;
@@ -346,6 +363,7 @@ void recCall(void (*func)())
 static void recRecompile(const u32 startpc);
 static void dyna_block_discard(u32 start, u32 sz);
 static void dyna_page_reset(u32 start, u32 sz);
+static void dyna_block_promote(u32 start);
 
 static const void* DispatcherEvent = nullptr;
 static const void* DispatcherReg = nullptr;
@@ -354,6 +372,7 @@ static const void* JITCompileInBlock = nullptr;
 static const void* EnterRecompiledCode = nullptr;
 static const void* DispatchBlockDiscard = nullptr;
 static const void* DispatchPageReset = nullptr;
+static const void* DispatchBlockPromote = nullptr;
 
 static void recEventTest()
 {
@@ -469,6 +488,14 @@ static const void* _DynGen_DispatchPageReset()
 	return retval;
 }
 
+static const void* _DynGen_DispatchBlockPromote()
+{
+	u8* retval = xGetPtr();
+	xFastCall((const void*)dyna_block_promote);
+	xJMP(DispatcherReg);
+	return retval;
+}
+
 static void _DynGen_Dispatchers()
 {
 	const u8* start = xGetAlignedCallTarget();
@@ -476,6 +503,8 @@ static void _DynGen_Dispatchers()
 	// Place the EventTest and DispatcherReg stuff at the top, because they get called the
 	// most and stand to benefit from strong alignment and direct referencing.
 	DispatcherEvent = _DynGen_DispatcherEvent();
+	Perf::any.Register(start, static_cast<u32>(xGetPtr() - start), "EE Event Test");
+	start = xGetPtr();
 	DispatcherReg = _DynGen_DispatcherReg();
 
 	JITCompile = _DynGen_JITCompile();
@@ -483,6 +512,7 @@ static void _DynGen_Dispatchers()
 	EnterRecompiledCode = _DynGen_EnterRecompiledCode();
 	DispatchBlockDiscard = _DynGen_DispatchBlockDiscard();
 	DispatchPageReset = _DynGen_DispatchPageReset();
+	DispatchBlockPromote = _DynGen_DispatchBlockPromote();
 
 	recBlocks.SetJITCompile(JITCompile);
 
@@ -572,6 +602,11 @@ static void recReserve()
 alignas(16) static u16 manual_page[Ps2MemSize::TotalRam >> 12];
 alignas(16) static u8 manual_counter[Ps2MemSize::TotalRam >> 12];
 
+// Copies of manually protected blocks, compared against guest memory when the block is entered.
+// Released all at once on reset; blocks fall back to per-instruction compares when it fills up.
+alignas(16) static u8 manual_snapshot[1024 * 1024];
+static u32 manual_snapshot_used = 0;
+
 ////////////////////////////////////////////////////
 static void recResetRaw()
 {
@@ -600,6 +635,12 @@ static void recResetRaw()
 
 	recBlocks.Reset();
 	vtlb_ClearLoadStoreInfo();
+	manual_snapshot_used = 0;
+
+	s_superblock_heat_slots.clear();
+	s_superblock_hot.clear();
+	s_superblock_ranges.clear();
+	mVUresetMacroQ();
 
 	g_branch = 0;
 	g_resetEeScalingStats = true;
@@ -736,6 +777,34 @@ void recClear(u32 addr, u32 size)
 		return;
 	addr = HWADDR(addr);
 
+	// Superblocks contain the ranges of other blocks, and the walk below stops at the first block which
+	// ends before the cleared range. Widen the range so any superblock it touches goes away whole.
+	if (!s_superblock_ranges.empty())
+	{
+		u32 end = addr + size * 4;
+		bool widened = true;
+		while (widened)
+		{
+			widened = false;
+			auto it = s_superblock_ranges.lower_bound((addr > 0x2000) ? (addr - 0x2000) : 0);
+			while (it != s_superblock_ranges.end() && it->first < end)
+			{
+				if (it->second <= addr)
+				{
+					++it;
+					continue;
+				}
+
+				addr = std::min(addr, it->first);
+				end = std::max(end, it->second);
+				it = s_superblock_ranges.erase(it);
+				widened = true;
+			}
+		}
+
+		size = (end - addr) / 4;
+	}
+
 	int blockidx = recBlocks.LastIndex(addr + size * 4 - 4);
 
 	if (blockidx == -1)
@@ -891,6 +960,56 @@ void SetBranchImm(u32 imm)
 	iBranchTest(imm);
 }
 
+static bool recIsSuperblockExit(u32 delay_pc)
+{
+	for (u32 i = 0; i < s_nSuperblockExits; i++)
+	{
+		if (s_superblock_exits[i] == delay_pc)
+			return true;
+	}
+
+	return false;
+}
+
+void SetBranchImmOrContinue(u32 imm)
+{
+	// Fall-through of a superblock side exit, keep compiling in the same block. The cycles so far are
+	// still accounted for here, and we leave through the dispatcher if an event is due, exactly like
+	// the plain block ending in this branch would have.
+	if (imm == pc && recIsSuperblockExit(pc - 4))
+	{
+		g_branch = 0;
+
+		// eax is never allocated, so the check doesn't disturb the registers the block carries on with.
+		xMOV(eax, ptr32[&cpuRegs.cycle]);
+		xADD(eax, scaleblockcycles_clear());
+		xMOV(ptr32[&cpuRegs.cycle], eax);
+		xSUB(eax, ptr32[&cpuRegs.nextEventCycle]);
+		xForwardJS32 no_event;
+
+		// Only the way out to the dispatcher needs the guest state in memory. Write back whatever is
+		// dirty there, then put the allocation back the way it was for the fall-through.
+		_x86regs saved_x86regs[iREGCNT_GPR];
+		_xmmregs saved_xmmregs[iREGCNT_XMM];
+		memcpy(saved_x86regs, x86regs, sizeof(x86regs));
+		memcpy(saved_xmmregs, xmmregs, sizeof(xmmregs));
+		const u32 saved_flushed_const = g_cpuFlushedConstReg;
+
+		_eeFlushAllDirty();
+		xMOV(ptr32[&cpuRegs.pc], imm);
+		xJMP((void*)DispatcherEvent);
+
+		memcpy(x86regs, saved_x86regs, sizeof(x86regs));
+		memcpy(xmmregs, saved_xmmregs, sizeof(xmmregs));
+		g_cpuFlushedConstReg = saved_flushed_const;
+
+		no_event.SetTarget();
+		return;
+	}
+
+	SetBranchImm(imm);
+}
+
 u8* recBeginThunk()
 {
 	// if recPtr reached the mem limit reset whole mem
@@ -2000,15 +2119,68 @@ void dyna_block_discard(u32 start, u32 sz)
 }
 
 // called when a page under manual protection has been run enough times to be a candidate
-// for being reset under the faster vtlb write protection.  All blocks in the page are cleared
-// and the block is re-assigned for write protection.
+// for being reset under the faster vtlb write protection.  The first time around the page is
+// only re-protected, its blocks keep their checks.  If nothing has written to it by the next
+// time the counter overflows, the blocks in the page are cleared so they recompile unchecked.
 void dyna_page_reset(u32 start, u32 sz)
 {
-	recClear(start & ~0xfffUL, 0x400);
+	if (mmap_GetRamPageInfo(start) == ProtMode_Write)
+	{
+		recClear(start & ~0xfffUL, 0x400);
+		return;
+	}
+
 	manual_counter[start >> 12]++;
 	mmap_MarkCountedRamPage(start);
 }
 
+// Emits the integrity check for a manually protected block as 16-byte compares against a
+// snapshot, accumulating the differences so there's a single branch at the end.
+static bool memory_protect_emit_wide_check(u32 inpage_ptr, u32 inpage_sz)
+{
+	const u32 snapshot_size = (inpage_sz + 15) & ~15u;
+	if (inpage_sz < 16 || (manual_snapshot_used + snapshot_size) > sizeof(manual_snapshot))
+		return false;
+
+	u8* snapshot = &manual_snapshot[manual_snapshot_used];
+	manual_snapshot_used += snapshot_size;
+	std::memcpy(snapshot, PSM(inpage_ptr), inpage_sz);
+
+	for (u32 offset = 0; offset < inpage_sz; offset += 16)
+	{
+		// the last chunk overlaps the one before it rather than reading past the end of the block
+		const u32 chunk = std::min(offset, inpage_sz - 16);
+		const xRegisterSSE& diff = (offset == 0) ? xmm1 : xmm0;
+
+		xMOVDQU(diff, ptr128[PSM(inpage_ptr + chunk)]);
+		if (chunk & 15)
+		{
+			xMOVDQU(xmm2, ptr128[snapshot + chunk]);
+			xPXOR(diff, xmm2);
+		}
+		else
+		{
+			xPXOR(diff, ptr128[snapshot + chunk]);
+		}
+
+		if (offset != 0)
+			xPOR(xmm1, xmm0);
+	}
+
+	xPTEST(xmm1, xmm1);
+	xJNZ(DispatchBlockDiscard);
+	return true;
+}
+
+// called when a block ending in a conditional branch has run often enough to be worth recompiling
+// as a superblock.
+void dyna_block_promote(u32 start)
+{
+	eeRecPerfLog.Write(Color_StrongGray, "Promoting block @ 0x%08X to superblock", start);
+	s_superblock_hot.insert(start);
+	recClear(start, 1);
+}
+
 static void memory_protect_recompiled_code(u32 startpc, u32 size)
 {
 	u32 inpage_ptr = HWADDR(startpc);
@@ -2037,16 +2209,19 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 			xMOV(arg2regd, inpage_sz / 4);
 			//xMOV( eax, startpc );		// uncomment this to access startpc (as eax) in dyna_block_discard
 
-			u32 lpc = inpage_ptr;
-			u32 stg = inpage_sz;
-
-			while (stg > 0)
+			if (!memory_protect_emit_wide_check(inpage_ptr, inpage_sz))
 			{
-				xCMP(ptr32[PSM(lpc)], *(u32*)PSM(lpc));
-				xJNE(DispatchBlockDiscard);
+				u32 lpc = inpage_ptr;
+				u32 stg = inpage_sz;
+
+				while (stg > 0)
+				{
+					xCMP(ptr32[PSM(lpc)], *(u32*)PSM(lpc));
+					xJNE(DispatchBlockDiscard);
 
-				stg -= 4;
-				lpc += 4;
+					stg -= 4;
+					lpc += 4;
+				}
 			}
 
 			// Tweakpoint!  3 is a 'magic' number representing the number of times a counted block
@@ -2067,13 +2242,9 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 				// to 'uncounted' mode if it's recompiled several times.  This protects against excessive
 				// recompilation of blocks that reside on the same codepage as data.
 
-				// fixme? Currently this algo is kinda dumb and results in the forced recompilation of a
-				// lot of blocks before it decides to mark a 'busy' page as uncounted.  There might be
-				// be a more clever approach that could streamline this process, by doing a first-pass
-				// test using the vtlb memory protection (without recompilation!) to reprotect a counted
-				// block.  But unless a new algo is relatively simple in implementation, it's probably
-				// not worth the effort (tests show that we have lots of recompiler memory to spare, and
-				// that the current amount of recompilation is fairly cheap).
+				// dyna_page_reset re-protects the page first without recompiling anything, and only
+				// clears the page's blocks once the protection has survived another full count.  Pages
+				// which keep getting written to therefore don't recompile every time the counter overflows.
 
 				xADD(ptr16[&manual_page[inpage_ptr >> 12]], size);
 				xJC(DispatchPageReset);
@@ -2171,6 +2342,75 @@ static bool recSkipTimeoutLoop(s32 reg, bool is_timeout_loop)
 	return true;
 }
 
+static bool recIsInSuperblock(u32 addr)
+{
+	auto it = s_superblock_ranges.upper_bound(addr);
+	if (it == s_superblock_ranges.begin())
+		return false;
+
+	--it;
+	return (addr < it->second);
+}
+
+// Returns true if the non-likely conditional branch at addr can be turned into a side exit,
+// with its fall-through path compiled as part of the current block.
+static bool recCanExtendSuperblock(u32 addr, bool seen_cop2)
+{
+	// COP2 passes assume the block has a single exit.
+	if (seen_cop2 || s_nSuperblockExits >= SUPERBLOCK_MAX_EXITS)
+		return false;
+
+	// branch, delay slot and fall-through have to stay on the same protected page
+	if (((addr + 8) & ~0xfffu) != (addr & ~0xfffu))
+		return false;
+
+	if (isBreakpointNeeded(addr + 4) != 0 || isMemcheckNeeded(addr + 4) != 0)
+		return false;
+
+	const u32 code = *(u32*)PSM(addr + 4);
+	switch (code >> 26)
+	{
+		case 0: // special
+		{
+			const u32 funct = code & 0x3f;
+			return (funct != 8 && funct != 9 && funct != 12 && funct != 13);
+		}
+
+		case 1: // regimm
+		case 2: // J
+		case 3: // JAL
+		case 4: // branches
+		case 5:
+		case 6:
+		case 7:
+		case 16: // cp0
+		case 17: // cp1
+		case 18: // cp2
+		case 20: // branch likely
+		case 21:
+		case 22:
+		case 23:
+		case 066: // LQC2
+		case 076: // SQC2
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+static void recMarkAllLive(EEINST* pinst)
+{
+	for (u8& reg : pinst->regs)
+		reg |= EEINST_LIVE;
+	for (u8& reg : pinst->fpuregs)
+		reg |= EEINST_LIVE;
+	for (u8& reg : pinst->vfregs)
+		reg |= EEINST_LIVE;
+	for (u8& reg : pinst->viregs)
+		reg |= EEINST_LIVE;
+}
+
 static void recRecompile(const u32 startpc)
 {
 	u32 i = 0;
@@ -2178,6 +2418,9 @@ static void recRecompile(const u32 startpc)
 
 	pxAssert(startpc);
 
+	// A new block can be emitted right where the last one ended, which must not look like a run of macro ops.
+	mVUresetMacroQ();
+
 	// if recPtr reached the mem limit reset whole mem
 	if (recPtr >= recPtrEnd)
 		eeRecNeedsReset = true;
@@ -2238,6 +2481,13 @@ static void recRecompile(const u32 startpc)
 
 	g_branch = 0;
 
+	// hot blocks extend through their conditional branches, cold ones may get a heat counter
+	const bool superblocks_enabled = EmuConfig.Cpu.Recompiler.EnableEESuperblocks && !recIsInSuperblock(HWADDR(startpc));
+	const bool form_superblock = superblocks_enabled && s_superblock_hot.count(HWADDR(startpc)) != 0;
+	bool superblock_candidate = false;
+	bool seen_cop2 = false;
+	s_nSuperblockExits = 0;
+
 	// reset recomp state variables
 	s_nBlockCycles = 0;
 	s_nBlockInterlocked = false;
@@ -2268,6 +2518,9 @@ static void recRecompile(const u32 startpc)
 		}
 	}
 
+	// the heat counter has to be the first thing in the block, the promote stub re-dispatches from startpc
+	const bool has_entry_calls = (xGetPtr() != recPtr);
+
 	// go until the next branch
 	i = startpc;
 	s_nEndBlock = 0xffffffff;
@@ -2325,7 +2578,9 @@ static void recRecompile(const u32 startpc)
 				break;
 			}
 
-			if (pblock->GetFnptr() != (uptr)JITCompile && pblock->GetFnptr() != (uptr)JITCompileInBlock)
+			// superblocks swallow the plain blocks in their range, they get cleared before compiling
+			if (pblock->GetFnptr() != (uptr)JITCompile && pblock->GetFnptr() != (uptr)JITCompileInBlock &&
+				(!form_superblock || s_superblock_ranges.count(HWADDR(i)) != 0))
 			{
 				willbranch3 = 1;
 				s_nEndBlock = i;
@@ -2335,6 +2590,7 @@ static void recRecompile(const u32 startpc)
 
 		//HUH ? PSM ? whut ? THIS IS VIRTUAL ACCESS GOD DAMMIT
 		cpuRegs.code = *(int*)PSM(i);
+		seen_cop2 |= (_Opcode_ == 022 || _Opcode_ == 066 || _Opcode_ == 076);
 
 		if (is_timeout_loop)
 		{
@@ -2381,6 +2637,19 @@ static void recRecompile(const u32 startpc)
 					s_branchTo = _Imm_ * 4 + i + 4;
 					if (s_branchTo > startpc && s_branchTo < i)
 						s_nEndBlock = s_branchTo;
+					else if (_Rt_ < 2 && superblocks_enabled && recCanExtendSuperblock(i, seen_cop2)) // BLTZ, BGEZ
+					{
+						if (form_superblock)
+						{
+							s_superblock_exits[s_nSuperblockExits++] = i + 4;
+							is_timeout_loop = false;
+							i += 8;
+							continue;
+						}
+
+						superblock_candidate = true;
+						s_nEndBlock = i + 8;
+					}
 					else
 						s_nEndBlock = i + 8;
 
@@ -2406,6 +2675,19 @@ static void recRecompile(const u32 startpc)
 				s_branchTo = _Imm_ * 4 + i + 4;
 				if (s_branchTo > startpc && s_branchTo < i)
 					s_nEndBlock = s_branchTo;
+				else if ((cpuRegs.code >> 26) < 8 && superblocks_enabled && recCanExtendSuperblock(i, seen_cop2)) // BEQ, BNE, BLEZ, BGTZ
+				{
+					if (form_superblock)
+					{
+						s_superblock_exits[s_nSuperblockExits++] = i + 4;
+						is_timeout_loop = false;
+						i += 8;
+						continue;
+					}
+
+					superblock_candidate = true;
+					s_nEndBlock = i + 8;
+				}
 				else
 					s_nEndBlock = i + 8;
 
@@ -2445,92 +2727,11 @@ static void recRecompile(const u32 startpc)
 
 StartRecomp:
 
-	// The idea here is that as long as a loop doesn't write to a register it's already read
-	// (excepting registers initialised with constants or memory loads) or use any instructions
-	// which alter the machine state apart from registers, it will do the same thing on every
-	// iteration.
+	// Loops which only poll memory or hardware registers skip ahead to the next event, see WaitLoopPass.
 	s_nBlockFF = false;
-	if (s_branchTo == startpc)
-	{
-		s_nBlockFF = true;
-
-		u32 reads = 0, loads = 1;
-
-		for (i = startpc; i < s_nEndBlock; i += 4)
-		{
-			if (i == s_nEndBlock - 8)
-				continue;
-			cpuRegs.code = *(u32*)PSM(i);
-			// nop
-			if (cpuRegs.code == 0)
-				continue;
-			// cache, sync
-			else if (_Opcode_ == 057 || (_Opcode_ == 0 && _Funct_ == 017))
-				continue;
-			// imm arithmetic
-			else if ((_Opcode_ & 070) == 010 || (_Opcode_ & 076) == 030)
-			{
-				if (loads & 1 << _Rs_)
-				{
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// common register arithmetic instructions
-			else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
-			{
-				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
-				{
-					loads |= 1 << _Rd_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_ | 1 << _Rt_;
-				if (reads & 1 << _Rd_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// loads
-			else if ((_Opcode_ & 070) == 040 || (_Opcode_ & 076) == 032 || _Opcode_ == 067)
-			{
-				if (loads & 1 << _Rs_)
-				{
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// mfc*, cfc*
-			else if ((_Opcode_ & 074) == 020 && _Rs_ < 4)
-			{
-				loads |= 1 << _Rt_;
-			}
-			else
-			{
-				s_nBlockFF = false;
-				break;
-			}
-		}
-	}
-	else
-	{
+	const bool is_self_loop = (s_branchTo == startpc && s_nSuperblockExits == 0);
+	if (!is_self_loop)
 		is_timeout_loop = false;
-	}
 
 	// rec info //
 	bool has_cop2_instructions = false;
@@ -2549,6 +2750,10 @@ StartRecomp:
 
 		for (i = s_nEndBlock; i > startpc; i -= 4)
 		{
+			// anything may be read after leaving through a side exit
+			if (s_nSuperblockExits > 0 && recIsSuperblockExit(i - 4))
+				recMarkAllLive(pcur);
+
 			cpuRegs.code = *(int*)PSM(i - 4);
 			pcur[-1] = pcur[0];
 			recBackpropBSC(cpuRegs.code, pcur - 1, pcur);
@@ -2567,6 +2772,13 @@ StartRecomp:
 			COP2FlagHackPass().Run(startpc, s_nEndBlock, s_pInstCache + 1);
 	}
 
+	if (is_self_loop && EmuConfig.Speedhacks.WaitLoop)
+	{
+		WaitLoopPass pass;
+		pass.Run(startpc, s_nEndBlock, s_pInstCache + 1);
+		s_nBlockFF = pass.IsWaitLoop();
+	}
+
 #ifdef DUMP_BLOCKS
 	ZydisDecoder disas_decoder;
 	ZydisDecoderInit(&disas_decoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_ADDRESS_WIDTH_64);
@@ -2587,12 +2799,32 @@ StartRecomp:
 #endif
 #endif
 
+	// Blocks which the superblock now covers have to go, otherwise clearing would leave stale code behind.
+	if (form_superblock)
+	{
+		recClear(startpc, (s_nEndBlock - startpc) >> 2);
+		s_pCurBlockEx = recBlocks.Get(HWADDR(startpc));
+		pxAssert(s_pCurBlockEx->startpc == HWADDR(startpc));
+	}
+
 	// Detect and handle self-modified code
 	memory_protect_recompiled_code(startpc, (s_nEndBlock - startpc) >> 2);
 
 	// Skip Recompilation if sceMpegIsEnd Pattern detected
 	const bool doRecompilation = !skipMPEG_By_Pattern(startpc) && !recSkipTimeoutLoop(timeout_reg, is_timeout_loop);
 
+	// Once every counter is handed out, further blocks just don't get promoted until the next reset.
+	if (doRecompilation && superblock_candidate && !has_entry_calls &&
+		(s_superblock_heat_slots.count(HWADDR(startpc)) != 0 || s_superblock_heat_slots.size() < std::size(s_superblock_heat)))
+	{
+		const u32 heat_index = s_superblock_heat_slots.try_emplace(HWADDR(startpc),
+			static_cast<u32>(s_superblock_heat_slots.size())).first->second;
+		s_superblock_heat[heat_index] = static_cast<u16>(0x10000 - SUPERBLOCK_HOT_THRESHOLD);
+		xMOV(arg1regd, HWADDR(startpc));
+		xADD(ptr16[&s_superblock_heat[heat_index]], 1);
+		xJC(DispatchBlockPromote);
+	}
+
 	if (doRecompilation)
 	{
 		// Finally: Generate x86 recompiled code!
@@ -2662,6 +2894,9 @@ StartRecomp:
 		memcpy(&recRAMCopy[HWADDR(startpc) / 4], PSM(startpc), pc - startpc);
 	}
 
+	if (form_superblock && pc > startpc)
+		s_superblock_ranges[HWADDR(startpc)] = HWADDR(pc);
+
 	s_pCurBlock->SetFnptr((uptr)recPtr);
 
 	for (i = 1; i < static_cast<u32>(s_pCurBlockEx->size); i++)
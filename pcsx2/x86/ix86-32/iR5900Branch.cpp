@@ -124,7 +124,7 @@ static void recBEQ_const()
 		branchTo = pc + 4;
 
 	recompileNextInstruction(true, false);
-	SetBranchImm(branchTo);
+	SetBranchImmOrContinue(branchTo);
 }
 
 static void recBEQ_process(int process)
@@ -160,7 +160,7 @@ static void recBEQ_process(int process)
 			recompileNextInstruction(true, false);
 		}
 
-		SetBranchImm(pc);
+		SetBranchImmOrContinue(pc);
 	}
 }
 
@@ -188,7 +188,7 @@ static void recBNE_const()
 		branchTo = pc + 4;
 
 	recompileNextInstruction(true, false);
-	SetBranchImm(branchTo);
+	SetBranchImmOrContinue(branchTo);
 }
 
 static void recBNE_process(int process)
@@ -198,7 +198,7 @@ static void recBNE_process(int process)
 	if (_Rs_ == _Rt_)
 	{
 		recompileNextInstruction(true, false);
-		SetBranchImm(pc);
+		SetBranchImmOrContinue(pc);
 		return;
 	}
 
@@ -224,7 +224,7 @@ static void recBNE_process(int process)
 		recompileNextInstruction(true, false);
 	}
 
-	SetBranchImm(pc);
+	SetBranchImmOrContinue(pc);
 }
 
 void recBNE()
@@ -530,7 +530,7 @@ void recBLEZ()
 			branchTo = pc + 4;
 
 		recompileNextInstruction(true, false);
-		SetBranchImm(branchTo);
+		SetBranchImmOrContinue(branchTo);
 		return;
 	}
 
@@ -563,7 +563,7 @@ void recBLEZ()
 		recompileNextInstruction(true, false);
 	}
 
-	SetBranchImm(pc);
+	SetBranchImmOrContinue(pc);
 }
 
 //// BGTZ
@@ -579,7 +579,7 @@ void recBGTZ()
 			branchTo = pc + 4;
 
 		recompileNextInstruction(true, false);
-		SetBranchImm(branchTo);
+		SetBranchImmOrContinue(branchTo);
 		return;
 	}
 
@@ -612,7 +612,7 @@ void recBGTZ()
 		recompileNextInstruction(true, false);
 	}
 
-	SetBranchImm(pc);
+	SetBranchImmOrContinue(pc);
 }
 
 ////////////////////////////////////////////////////
@@ -628,7 +628,7 @@ void recBLTZ()
 			branchTo = pc + 4;
 
 		recompileNextInstruction(true, false);
-		SetBranchImm(branchTo);
+		SetBranchImmOrContinue(branchTo);
 		return;
 	}
 
@@ -654,7 +654,7 @@ void recBLTZ()
 		recompileNextInstruction(true, false);
 	}
 
-	SetBranchImm(pc);
+	SetBranchImmOrContinue(pc);
 }
 
 ////////////////////////////////////////////////////
@@ -670,7 +670,7 @@ void recBGEZ()
 			branchTo = pc + 4;
 
 		recompileNextInstruction(true, false);
-		SetBranchImm(branchTo);
+		SetBranchImmOrContinue(branchTo);
 		return;
 	}
 
@@ -697,7 +697,7 @@ void recBGEZ()
 		recompileNextInstruction(true, false);
 	}
 
-	SetBranchImm(pc);
+	SetBranchImmOrContinue(pc);
 }
 
 ////////////////////////////////////////////////////
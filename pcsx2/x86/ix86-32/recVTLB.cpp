@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Common.h"
+#include "Cache.h"
 #include "vtlb.h"
 #include "x86/iCore.h"
 #include "x86/iR5900.h"
@@ -150,11 +151,6 @@ namespace vtlb_private
 				xMOV(arg2reg, xRegister64(value_reg));
 			}
 		}
-
-		xMOV(eax, arg1regd);
-		xSHR(eax, VTLB_PAGE_BITS);
-		xMOV(rax, ptrNative[xComplexAddress(arg3reg, vtlbdata.vmap, rax * wordsize)]);
-		xADD(arg1reg, rax);
 	}
 
 	// ------------------------------------------------------------------------
@@ -229,6 +225,9 @@ static constexpr u32 INDIRECT_DISPATCHER_SIZE = 32;
 static constexpr u32 INDIRECT_DISPATCHERS_SIZE = 2 * 5 * 2 * INDIRECT_DISPATCHER_SIZE;
 static u8* m_IndirectDispatchers = nullptr;
 
+// [mode][operandsize][sign], variable length so they're not packed like the indirect dispatchers.
+static u8* m_CacheDispatchers[2][5][2] = {};
+
 // ------------------------------------------------------------------------
 // mode        - 0 for read, 1 for write!
 // operandsize - 0 thru 4 represents 8, 16, 32, 64, and 128 bits.
@@ -259,11 +258,34 @@ static void DynGen_HandlerTest(const GenDirectFn& gen_direct, int mode, int bits
 		case 128: szidx = 4; break;
 		jNO_DEFAULT;
 	}
-	xForwardJS8 to_handler;
-	gen_direct();
+
+	const auto gen_lookup = [&]() {
+		xMOV(rax, ptrNative[xComplexAddress(arg3reg, vtlbdata.vmap, rax * wordsize)]);
+		xADD(arg1reg, rax);
+
+		xForwardJS8 to_handler;
+		gen_direct();
+		xForwardJump8 done;
+		to_handler.SetTarget();
+		xFastCall(GetIndirectDispatcherPtr(mode, szidx, sign));
+		done.SetTarget();
+	};
+
+	xMOV(eax, arg1regd);
+	xSHR(eax, VTLB_PAGE_BITS);
+	if (!CHECK_CACHE)
+	{
+		gen_lookup();
+		return;
+	}
+
+	// Cacheable pages go to the cache dispatcher with the untranslated address.
+	xCMP(ptr8[xComplexAddress(arg3reg, vtlbdata.cmap, rax)], 0);
+	xForwardJNZ8 to_cache;
+	gen_lookup();
 	xForwardJump8 done;
-	to_handler.SetTarget();
-	xFastCall(GetIndirectDispatcherPtr(mode, szidx, sign));
+	to_cache.SetTarget();
+	xFastCall(m_CacheDispatchers[mode][szidx][sign]);
 	done.SetTarget();
 }
 
@@ -330,6 +352,103 @@ static void DynGen_IndirectTlbDispatcher(int mode, int bits, bool sign)
 	xRET();
 }
 
+// ------------------------------------------------------------------------
+// Generates the data cache dispatchers, used for pages which are cacheable while the cache is emulated.
+// Hits on an unlocked way are done straight on the cache line. Misses, locked ways and handler pages
+// fall back to vtlb_memRead/vtlb_memWrite, which take care of fills and write backs.
+// In: arg1reg: vaddr, arg2reg/xmm1: data (writes)
+// Out: rax/xmm0: result (reads)
+static void DynGen_CacheDispatcher(int mode, int bits, bool sign)
+{
+	const CacheRecInfo info = getCacheRecInfo();
+	pxAssertRel(info.set_stride == 3 * 64, "Cache set layout doesn't match the dispatcher");
+
+	xMOV(eax, arg1regd);
+	xSHR(eax, VTLB_PAGE_BITS);
+	xMOV(rax, ptrNative[xComplexAddress(arg3reg, vtlbdata.vmap, rax * wordsize)]);
+	xADD(rax, arg1reg);
+	xForwardJS32 to_fallback;
+
+	// r10 = set for the address, rax = the tag value it has to match.
+	xMOV(r10d, arg1regd);
+	xAND(r10d, 0xFC0);
+	xLEA(r10, ptr[xAddressVoid(r10, r10, 2)]);
+	xLoadFarAddr(r11, info.sets);
+	xADD(r10, r11);
+	xAND(rax, static_cast<s32>(info.addr_mask));
+
+	const auto gen_tag_test = [&](int way) {
+		xMOV(arg3reg, ptrNative[r10 + info.tag_offset[way]]);
+		xXOR(arg3reg, rax);
+		xXOR(arg3reg, static_cast<s32>(info.valid_flag));
+		xTEST(arg3reg, static_cast<s32>(info.addr_mask | info.valid_flag | info.lock_flag));
+	};
+	gen_tag_test(0);
+	xForwardJZ32 hit_way0;
+	gen_tag_test(1);
+	xForwardJZ32 hit_way1;
+
+	to_fallback.SetTarget();
+#ifdef _WIN32
+	xSUB(rsp, 32 + 8);
+#else
+	xSUB(rsp, 8);
+#endif
+
+	static void* const read_fallbacks[5] = {(void*)&vtlb_memRead<mem8_t>, (void*)&vtlb_memRead<mem16_t>,
+		(void*)&vtlb_memRead<mem32_t>, (void*)&vtlb_memRead<mem64_t>, (void*)&vtlb_memRead128};
+	static void* const write_fallbacks[5] = {(void*)&vtlb_memWrite<mem8_t>, (void*)&vtlb_memWrite<mem16_t>,
+		(void*)&vtlb_memWrite<mem32_t>, (void*)&vtlb_memWrite<mem64_t>, (void*)&vtlb_memWrite128};
+	xFastCall(mode ? write_fallbacks[bits] : read_fallbacks[bits]);
+
+	if (!mode)
+	{
+		if (bits == 0)
+		{
+			if (sign)
+				xMOVSX(rax, al);
+			else
+				xMOVZX(rax, al);
+		}
+		else if (bits == 1)
+		{
+			if (sign)
+				xMOVSX(rax, ax);
+			else
+				xMOVZX(rax, ax);
+		}
+		else if (bits == 2)
+		{
+			if (sign)
+				xCDQE();
+		}
+	}
+
+#ifdef _WIN32
+	xADD(rsp, 32 + 8);
+#else
+	xADD(rsp, 8);
+#endif
+	xRET();
+
+	const auto gen_hit = [&](int way) {
+		if (mode)
+			xOR(ptrNative[r10 + info.tag_offset[way]], static_cast<s32>(info.dirty_flag));
+
+		xAND(arg1regd, 0x3F & ~((1 << bits) - 1));
+		xLEA(arg1reg, ptr[r10 + arg1reg + info.data_offset[way]]);
+		if (mode)
+			DynGen_DirectWrite(8 << bits);
+		else
+			DynGen_DirectRead(8 << bits, sign);
+		xRET();
+	};
+	hit_way0.SetTarget();
+	gen_hit(0);
+	hit_way1.SetTarget();
+	gen_hit(1);
+}
+
 // One-time initialization procedure.  Multiple subsequent calls during the lifespan of the
 // process will be ignored.
 //
@@ -356,6 +475,21 @@ void vtlb_DynGenDispatchers()
 	Perf::any.Register(m_IndirectDispatchers, INDIRECT_DISPATCHERS_SIZE, "TLB Dispatcher");
 
 	xSetPtr(m_IndirectDispatchers + INDIRECT_DISPATCHERS_SIZE);
+
+	const u8* cache_dispatchers = xGetAlignedCallTarget();
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		for (int bits = 0; bits < 5; ++bits)
+		{
+			for (int sign = 0; sign < (!mode && bits < 3 ? 2 : 1); sign++)
+			{
+				m_CacheDispatchers[mode][bits][sign] = xGetAlignedCallTarget();
+				DynGen_CacheDispatcher(mode, bits, !!sign);
+			}
+		}
+	}
+
+	Perf::any.Register(cache_dispatchers, static_cast<u32>(xGetPtr() - cache_dispatchers), "TLB Cache Dispatcher");
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -449,6 +583,14 @@ int vtlb_DynGenReadNonQuad(u32 bits, bool sign, bool xmm, int addr_reg, vtlb_Rea
 //
 int vtlb_DynGenReadNonQuad_Const(u32 bits, bool sign, bool xmm, u32 addr_const, vtlb_ReadRegAllocCallback dest_reg_alloc)
 {
+	// Whether a page is cacheable can change after the block is compiled, so leave it to the runtime check.
+	if (CHECK_CACHE && !vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS].isHandler(addr_const))
+	{
+		_freeX86reg(arg1regd);
+		xMOV(arg1regd, addr_const);
+		return vtlb_DynGenReadNonQuad(bits, sign, xmm, arg1regd.GetId(), dest_reg_alloc);
+	}
+
 	EE::Profiler.EmitConstMem(addr_const);
 
 	int x86_dest_reg;
@@ -596,6 +738,13 @@ int vtlb_DynGenReadQuad_Const(u32 bits, u32 addr_const, vtlb_ReadRegAllocCallbac
 {
 	pxAssert(bits == 128);
 
+	if (CHECK_CACHE && !vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS].isHandler(addr_const))
+	{
+		_freeX86reg(arg1regd);
+		xMOV(arg1regd, addr_const);
+		return vtlb_DynGenReadQuad(bits, arg1regd.GetId(), dest_reg_alloc);
+	}
+
 	EE::Profiler.EmitConstMem(addr_const);
 
 	int reg;
@@ -747,6 +896,13 @@ void vtlb_DynGenWrite(u32 sz, bool xmm, int addr_reg, int value_reg)
 // recompiler if the TLB is changed.
 void vtlb_DynGenWrite_Const(u32 bits, bool xmm, u32 addr_const, int value_reg)
 {
+	if (CHECK_CACHE && !vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS].isHandler(addr_const))
+	{
+		xMOV(arg1regd, addr_const);
+		vtlb_DynGenWrite(bits, xmm, arg1regd.GetId(), value_reg);
+		return;
+	}
+
 	EE::Profiler.EmitConstMem(addr_const);
 
 #ifdef LOG_STORES
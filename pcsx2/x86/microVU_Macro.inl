@@ -20,13 +20,29 @@ using namespace R5900::Dynarec;
 // we enter micro mode, they will get overriden otherwise...
 #define FLUSH_FOR_POSSIBLE_MICRO_EXEC (FLUSH_FREE_XMM | FLUSH_FREE_VU0)
 
+// Where the last macro op which had Q in xmmPQ finished. VF regs are already preserved across
+// back-to-back ops by the register allocator, this lets Q skip the reload in the same way.
+// Anything emitted in between (syncs, calls, other instructions) moves x86Ptr and breaks the run.
+static u8* s_macroQEndPtr = nullptr;
+static u32 s_macroQEndPC = 0;
+
+void mVUresetMacroQ()
+{
+	s_macroQEndPtr = nullptr;
+	s_macroQEndPC = 0;
+}
+
 void setupMacroOp(int mode, const char* opName)
 {
 	// Set up reg allocation
 	microVU0.regAlloc->reset(true);
 
+	bool q_in_reg = false;
 	if (mode & 0x03) // Q will be read/written
+	{
+		q_in_reg = (s_macroQEndPtr == x86Ptr && s_macroQEndPC == (pc - 4) && !xmmregs[xmmPQ.Id].inuse);
 		_freeXMMreg(xmmPQ.Id);
+	}
 
 	// Set up MicroVU ready for new op
 	printCOP2(opName);
@@ -35,7 +51,7 @@ void setupMacroOp(int mode, const char* opName)
 	microVU0.code = cpuRegs.code;
 	memset(&microVU0.prog.IRinfo.info[0], 0, sizeof(microVU0.prog.IRinfo.info[0]));
 
-	if (mode & 0x01) // Q-Reg will be Read
+	if (mode & 0x01 && !q_in_reg) // Q-Reg will be Read
 	{
 		xMOVSSZX(xmmPQ, ptr32[&vu0Regs.VI[REG_Q].UL]);
 	}
@@ -101,6 +117,10 @@ void endMacroOp(int mode)
 
 	microVU0.cop2 = 0;
 	microVU0.regAlloc->reset(false);
+
+	// memory is still kept up to date above, since anything outside the run reads Q from there
+	s_macroQEndPtr = (mode & 0x03) ? x86Ptr : nullptr;
+	s_macroQEndPC = pc;
 }
 
 void mVUFreeCOP2XMMreg(int hostreg)
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "common/Pcsx2Defs.h"
+#include "common/SHA1Digest.h"
+#include "common/StringUtil.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string_view>
+
+static std::string SHA1Hex(const std::string_view str, u32 chunk_size)
+{
+	SHA1Digest digest;
+	for (size_t pos = 0; pos < str.size(); pos += chunk_size)
+	{
+		const size_t len = std::min<size_t>(chunk_size, str.size() - pos);
+		digest.Update(str.data() + pos, static_cast<u32>(len));
+	}
+
+	u8 result[SHA1Digest::DIGEST_SIZE];
+	digest.Final(result);
+	return StringUtil::EncodeHex(result, SHA1Digest::DIGEST_SIZE);
+}
+
+TEST(SHA1Digest, KnownVectors)
+{
+	ASSERT_EQ(SHA1Hex("", 64), "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+	ASSERT_EQ(SHA1Hex("abc", 64), "a9993e364706816aba3e25717850c26c9cd0d89d");
+	ASSERT_EQ(SHA1Hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 64),
+		"84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+	ASSERT_EQ(SHA1Hex("The quick brown fox jumps over the lazy dog", 64),
+		"2fd4e1c67a2d28fced849ee1bb76e7391b93eb12");
+}
+
+TEST(SHA1Digest, MillionA)
+{
+	const std::string str(1000000, 'a');
+	ASSERT_EQ(SHA1Hex(str, 4096), "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+}
+
+TEST(SHA1Digest, SplitUpdates)
+{
+	// Lengths around the 64 byte block and the 56 byte padding boundary.
+	std::string str;
+	for (u32 i = 0; i < 200; i++)
+		str.push_back(static_cast<char>('a' + (i % 26)));
+
+	for (const u32 len : {55u, 56u, 63u, 64u, 65u, 119u, 120u, 200u})
+	{
+		const std::string_view sv(str.data(), len);
+		const std::string expected = SHA1Hex(sv, len);
+		for (const u32 chunk : {1u, 3u, 17u, 63u, 64u})
+			ASSERT_EQ(SHA1Hex(sv, chunk), expected) << "length " << len << " chunk " << chunk;
+	}
+}
+
+TEST(SHA1Digest, Reset)
+{
+	SHA1Digest digest;
+	digest.Update("garbage", 7);
+	digest.Reset();
+	digest.Update("abc", 3);
+
+	u8 result[SHA1Digest::DIGEST_SIZE];
+	digest.Final(result);
+	ASSERT_EQ(StringUtil::EncodeHex(result, SHA1Digest::DIGEST_SIZE), "a9993e364706816aba3e25717850c26c9cd0d89d");
+}
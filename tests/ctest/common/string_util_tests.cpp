@@ -130,3 +130,13 @@ TEST(StringUtil, EllipsiseInPlace)
 	StringUtil::EllipsiseInPlace(s, 10, "...");
 	ASSERT_EQ(s, "Hello");
 }
+
+TEST(StringUtil, JSONString)
+{
+	ASSERT_EQ(StringUtil::JSONString(""), "\"\"");
+	ASSERT_EQ(StringUtil::JSONString("Hello"), "\"Hello\"");
+	ASSERT_EQ(StringUtil::JSONString("a\"b\\c"), "\"a\\\"b\\\\c\"");
+	ASSERT_EQ(StringUtil::JSONString("a\tb\r\n"), "\"a\\tb\\r\\n\"");
+	ASSERT_EQ(StringUtil::JSONString(std::string_view("\x01\x1f", 2)), "\"\\u0001\\u001f\"");
+	ASSERT_EQ(StringUtil::JSONString("\xc3\xa9"), "\"\xc3\xa9\"");
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/GameDatabase.h"
+#include <gtest/gtest.h>
+
+static constexpr u64 SOURCE_SIZE = 123456;
+static constexpr s64 SOURCE_TIMESTAMP = 1700000000;
+
+static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> CreateTestDatabase()
+{
+	std::unordered_map<std::string, GameDatabaseSchema::GameEntry> db;
+
+	GameDatabaseSchema::GameEntry& full = db["slus-20312"];
+	full.name = "Test Game";
+	full.name_sort = "Test Game, The";
+	full.name_en = "The Test Game";
+	full.region = "NTSC-U";
+	full.compat = GameDatabaseSchema::Compatibility::Playable;
+	full.eeRoundMode = FPRoundMode::ChopZero;
+	full.vu1RoundMode = FPRoundMode::NegativeInfinity;
+	full.eeClampMode = GameDatabaseSchema::ClampMode::Full;
+	full.gameFixes = {Fix_FpuMultiply, Fix_GoemonTlbMiss};
+	full.speedHacks = {{SpeedHack::MTVU, 0}, {SpeedHack::EECycleRate, -2}};
+	full.gsHWFixes = {{GameDatabaseSchema::GSHWFixId::AutoFlush, 2}};
+	full.memcardFilters = {"SLUS-20312", "SLUS-20313"};
+	full.patches.emplace(0x12345678u, "patch=1,EE,00100000,word,00000000");
+	full.dynaPatches.push_back({{{0, 0x27bdfff0}, {4, 0xffbf0000}}, {{8, 0x00000000}}});
+
+	db["sles-50001"].name = "Second Game";
+
+	return db;
+}
+
+TEST(GameDatabase, BinaryRoundTrip)
+{
+	const std::unordered_map<std::string, GameDatabaseSchema::GameEntry> db = CreateTestDatabase();
+	const std::vector<u8> data = GameDatabase::serializeBinaryDatabase(db, SOURCE_SIZE, SOURCE_TIMESTAMP);
+	ASSERT_TRUE(GameDatabase::isBinaryDatabaseValid(data.data(), data.size(), SOURCE_SIZE, SOURCE_TIMESTAMP));
+
+	for (const auto& [serial, expected] : db)
+	{
+		GameDatabaseSchema::GameEntry entry;
+		ASSERT_TRUE(GameDatabase::decodeBinaryDatabaseEntry(data.data(), data.size(), serial, &entry)) << serial;
+		EXPECT_EQ(entry.name, expected.name);
+		EXPECT_EQ(entry.name_sort, expected.name_sort);
+		EXPECT_EQ(entry.name_en, expected.name_en);
+		EXPECT_EQ(entry.region, expected.region);
+		EXPECT_EQ(entry.compat, expected.compat);
+		EXPECT_EQ(entry.eeRoundMode, expected.eeRoundMode);
+		EXPECT_EQ(entry.eeDivRoundMode, expected.eeDivRoundMode);
+		EXPECT_EQ(entry.vu0RoundMode, expected.vu0RoundMode);
+		EXPECT_EQ(entry.vu1RoundMode, expected.vu1RoundMode);
+		EXPECT_EQ(entry.eeClampMode, expected.eeClampMode);
+		EXPECT_EQ(entry.vu0ClampMode, expected.vu0ClampMode);
+		EXPECT_EQ(entry.vu1ClampMode, expected.vu1ClampMode);
+		EXPECT_EQ(entry.gameFixes, expected.gameFixes);
+		EXPECT_EQ(entry.speedHacks, expected.speedHacks);
+		EXPECT_EQ(entry.gsHWFixes, expected.gsHWFixes);
+		EXPECT_EQ(entry.memcardFilters, expected.memcardFilters);
+		EXPECT_EQ(entry.patches, expected.patches);
+
+		ASSERT_EQ(entry.dynaPatches.size(), expected.dynaPatches.size());
+		for (size_t i = 0; i < entry.dynaPatches.size(); i++)
+		{
+			const Patch::DynamicPatch& patch = entry.dynaPatches[i];
+			const Patch::DynamicPatch& expected_patch = expected.dynaPatches[i];
+			ASSERT_EQ(patch.pattern.size(), expected_patch.pattern.size());
+			ASSERT_EQ(patch.replacement.size(), expected_patch.replacement.size());
+			for (size_t j = 0; j < patch.pattern.size(); j++)
+			{
+				EXPECT_EQ(patch.pattern[j].offset, expected_patch.pattern[j].offset);
+				EXPECT_EQ(patch.pattern[j].value, expected_patch.pattern[j].value);
+			}
+			for (size_t j = 0; j < patch.replacement.size(); j++)
+			{
+				EXPECT_EQ(patch.replacement[j].offset, expected_patch.replacement[j].offset);
+				EXPECT_EQ(patch.replacement[j].value, expected_patch.replacement[j].value);
+			}
+		}
+	}
+
+	GameDatabaseSchema::GameEntry entry;
+	EXPECT_FALSE(GameDatabase::decodeBinaryDatabaseEntry(data.data(), data.size(), "slps-99999", &entry));
+}
+
+TEST(GameDatabase, BinaryRejectsStaleCache)
+{
+	const std::vector<u8> data = GameDatabase::serializeBinaryDatabase(CreateTestDatabase(), SOURCE_SIZE, SOURCE_TIMESTAMP);
+
+	// The YAML changed since the cache was written.
+	EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(data.data(), data.size(), SOURCE_SIZE + 1, SOURCE_TIMESTAMP));
+	EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(data.data(), data.size(), SOURCE_SIZE, SOURCE_TIMESTAMP + 1));
+
+	// Written by a build with a different version or layout, which sit after the signature in the header.
+	for (size_t offset = 4; offset < 12; offset += 4)
+	{
+		std::vector<u8> modified = data;
+		modified[offset] ^= 0xff;
+		EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(modified.data(), modified.size(), SOURCE_SIZE, SOURCE_TIMESTAMP))
+			<< "offset " << offset;
+	}
+
+	// Truncated files, e.g. from a crash while writing.
+	EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(data.data(), 0, SOURCE_SIZE, SOURCE_TIMESTAMP));
+	EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(data.data(), 16, SOURCE_SIZE, SOURCE_TIMESTAMP));
+	EXPECT_FALSE(GameDatabase::isBinaryDatabaseValid(data.data(), data.size() - 1, SOURCE_SIZE, SOURCE_TIMESTAMP));
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/SPU2/defs.h"
+#include <gtest/gtest.h>
+
+#include <random>
+
+static u32 ReferenceIndex(u32 cycles, u32 effects_start, u32 effects_end, u32 offset)
+{
+	const u32 start = effects_start & 0x3f'ffff;
+	const u32 size = ((effects_end & 0x3f'ffff) | 0xffff) - start + 1;
+	return ((((cycles >> 1) + offset) % size) + start) & 0xf'ffff;
+}
+
+static void CheckIndex(u32 cycles, u32 effects_start, u32 effects_end, u32 offset)
+{
+	const ReverbIndexer indexer(cycles, effects_start, effects_end);
+	ASSERT_EQ(indexer(offset), ReferenceIndex(cycles, effects_start, effects_end, offset))
+		<< "cycles=" << cycles << " start=" << effects_start << " end=" << effects_end << " offset=" << offset;
+}
+
+TEST(SPU2Reverb, IndexerMatchesModuloForRandomInputs)
+{
+	std::mt19937 rng(0x5052u);
+	std::uniform_int_distribution<u32> any;
+	std::uniform_int_distribution<u32> start_dist(0, 0xfffff);
+	std::uniform_int_distribution<u32> small_offset(0, 0x40000);
+
+	for (int i = 0; i < 200000; i++)
+	{
+		const u32 start = start_dist(rng);
+		const u32 end = std::uniform_int_distribution<u32>(start, 0xfffff)(rng);
+		const u32 cycles = any(rng);
+		CheckIndex(cycles, start, end, small_offset(rng));
+		CheckIndex(cycles, start, end, any(rng));
+	}
+}
+
+TEST(SPU2Reverb, IndexerWrapsAt32Bits)
+{
+	static constexpr u32 starts[] = {0x0, 0x2800, 0xe0000, 0xeff00, 0xfffff};
+	static constexpr u32 cycles[] = {0x0, 0x1, 0x7fff'ffff, 0xffff'fffe, 0xffff'ffff};
+
+	for (const u32 start : starts)
+	{
+		for (const u32 cycle : cycles)
+		{
+			for (u32 back = 0; back < 64; back++)
+			{
+				// Destination registers of zero have 1 subtracted from them, which lands up here.
+				CheckIndex(cycle, start, 0xfffff, 0xffff'ffffu - back);
+				CheckIndex(cycle, start, start, 0xffff'ffffu - back);
+				CheckIndex(cycle, start, 0xfffff, 0x8000'0000u + back);
+			}
+		}
+	}
+}
+
+TEST(SPU2Reverb, IndexerHandlesExactMultiplesOfTheSize)
+{
+	static constexpr u32 starts[] = {0x0, 0x2800, 0xe0000, 0xf0000};
+
+	for (const u32 start : starts)
+	{
+		for (const u32 end : {start, start | 0x1ffff, 0xfffffu})
+		{
+			const u32 size = ((end & 0x3f'ffff) | 0xffff) - start + 1;
+			for (const u32 cycle : {0u, 2u, size * 2, size * 2 + 1, size * 6 - 2, 0xffff'ffffu})
+			{
+				const u32 base = cycle >> 1;
+				const u32 to_multiple = size - (base % size);
+				for (const u32 offset : {0u, size - 1, size, size + 1, size * 2, size * 3 - 1, to_multiple - 1,
+						 to_multiple, to_multiple + 1, to_multiple + size})
+				{
+					CheckIndex(cycle, start, end, offset);
+				}
+			}
+		}
+	}
+}